@@ -196,7 +196,7 @@ void Camera::applyModPosition(Vec3& pos) {
   if(auto pl = gothic.player()) {
     Matrix4x4 rot;
     rot.identity();
-    rot.rotateOY(90-pl->rotation());
+    rot.rotateOY(90-pl->renderRotation());
     rot.project(rotOffset.x,rotOffset.y,rotOffset.z);
     }
   pos+=rotOffset;
@@ -10,27 +10,32 @@ SvmDefinitions::~SvmDefinitions() {
   }
 
 const Daedalus::ZString& SvmDefinitions::find(const char *speech, const int intId) {
+  static Daedalus::ZString empty;
   if(speech!=nullptr && speech[0]=='$' && intId>=0){
     const size_t id=size_t(intId);
 
     char name[128]={};
-    std::snprintf(name,sizeof(name),"SVM_%d",int(id));
-
     if(svm.size()<=id)
       svm.resize(id+1);
     if(svm[id]==nullptr)
       svm[id].reset(new Daedalus::GEngineClasses::C_SVM());
     if(svm[id]->instanceSymbol==0){
+      std::snprintf(name,sizeof(name),"SVM_%d",int(id));
       size_t i = vm.getDATFile().getSymbolIndexByName(name);
       vm.initializeInstance(*svm[id], i, Daedalus::IC_Svm);
       }
 
-    std::snprintf(name,sizeof(name),"C_SVM.%s",speech+1);
+    auto fld = fields.find(speech+1);
+    if(fld==fields.end()) {
+      std::snprintf(name,sizeof(name),"C_SVM.%s",speech+1);
+      fld = fields.emplace(speech+1,vm.getDATFile().getSymbolIndexByName(name)).first;
+      }
+    if(fld->second==size_t(-1))
+      return empty;
 
-    auto& i = vm.getDATFile().getSymbolByName(name); //TODO: optimize
+    auto& i = vm.getDATFile().getSymbolByIndex(fld->second);
     return i.getString(0,svm[size_t(id)].get());
     }
 
-  static Daedalus::ZString empty;
   return empty;
   }
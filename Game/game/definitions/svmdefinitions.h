@@ -3,6 +3,8 @@
 #include <daedalus/DaedalusStdlib.h>
 #include <daedalus/ZString.h>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 class Gothic;
 
@@ -16,5 +18,6 @@ class SvmDefinitions final {
   private:
     Daedalus::DaedalusVM&                                         vm;
     std::vector<std::unique_ptr<Daedalus::GEngineClasses::C_SVM>> svm;
+    std::unordered_map<std::string,size_t>                        fields; // speech name -> C_SVM member symbol
   };
 
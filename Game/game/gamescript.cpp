@@ -16,6 +16,8 @@
 using namespace Tempest;
 using namespace Daedalus::GameState;
 
+static const size_t unresolvedFn = size_t(-2);
+
 struct GameScript::ScopeVar final {
   ScopeVar(Daedalus::DaedalusVM& vm,Daedalus::PARSymbol& sym,Npc& n)
     :ScopeVar(vm,sym,n.handle(),Daedalus::IC_Npc){
@@ -64,6 +66,8 @@ bool GameScript::GlobalOutput::isFinished() {
 
 GameScript::GameScript(GameSession &owner)
   :vm(owner.loadScriptCode()),owner(owner) {
+  if(owner.isProfileMode())
+    profiler.reset(new ScriptProfiler());
   Daedalus::registerGothicEngineClasses(vm);
   owner.setupVmCommonApi(vm);
   aiDefaultPipe.reset(new GlobalOutput(*this));
@@ -73,226 +77,238 @@ GameScript::GameScript(GameSession &owner)
 GameScript::GameScript(GameSession &owner, Serialize &fin)
   :GameScript(owner) {
   quests.load(fin);
-  uint32_t sz=0;
-  fin.read(sz);
-  for(size_t i=0;i<sz;++i){
-    uint32_t f=0,s=0;
-    fin.read(f,s);
-    dlgKnownInfos.insert(std::make_pair(f,s));
-    }
+  dlgKnownInfos.load(fin);
 
   fin.read(gilAttitudes);
   }
 
 GameScript::~GameScript() {
   vm.clearReferences(Daedalus::IC_Info);
+  if(profiler!=nullptr) {
+    std::ofstream out("scriptprofile.txt");
+    profiler->report(out,[this](size_t i){ return vm.getDATFile().getSymbolByIndex(i).name.c_str(); });
+    Log::i("script profile is written to \"scriptprofile.txt\"");
+    }
+  }
+
+void GameScript::bindExternal(const char* name, std::function<void(Daedalus::DaedalusVM&)> fn) {
+  if(profiler==nullptr) {
+    vm.registerExternalFunction(name,fn);
+    return;
+    }
+  auto p  = profiler.get();
+  auto id = vm.getDATFile().getSymbolIndexByName(name);
+  vm.registerExternalFunction(name,[p,id,fn](Daedalus::DaedalusVM& vm){
+    ScriptProfiler::Scope scope(p,id);
+    fn(vm);
+    });
   }
 
 void GameScript::initCommon() {
-  vm.registerExternalFunction("hlp_random",          [this](Daedalus::DaedalusVM& vm){ hlp_random(vm);         });
-  vm.registerExternalFunction("hlp_isvalidnpc",      [this](Daedalus::DaedalusVM& vm){ hlp_isvalidnpc(vm);     });
-  vm.registerExternalFunction("hlp_isvaliditem",     [this](Daedalus::DaedalusVM& vm){ hlp_isvaliditem(vm);    });
-  vm.registerExternalFunction("hlp_isitem",          [this](Daedalus::DaedalusVM& vm){ hlp_isitem(vm);         });
-  vm.registerExternalFunction("hlp_getnpc",          [this](Daedalus::DaedalusVM& vm){ hlp_getnpc(vm);         });
-  vm.registerExternalFunction("hlp_getinstanceid",   [this](Daedalus::DaedalusVM& vm){ hlp_getinstanceid(vm);  });
-
-  vm.registerExternalFunction("wld_insertnpc",       [this](Daedalus::DaedalusVM& vm){ wld_insertnpc(vm);  });
-  vm.registerExternalFunction("wld_insertitem",      [this](Daedalus::DaedalusVM& vm){ wld_insertitem(vm); });
-  vm.registerExternalFunction("wld_settime",         [this](Daedalus::DaedalusVM& vm){ wld_settime(vm);    });
-  vm.registerExternalFunction("wld_getday",          [this](Daedalus::DaedalusVM& vm){ wld_getday(vm);     });
-  vm.registerExternalFunction("wld_playeffect",      [this](Daedalus::DaedalusVM& vm){ wld_playeffect(vm); });
-  vm.registerExternalFunction("wld_stopeffect",      [this](Daedalus::DaedalusVM& vm){ wld_stopeffect(vm); });
-  vm.registerExternalFunction("wld_getplayerportalguild",
-                                                     [this](Daedalus::DaedalusVM& vm){ wld_getplayerportalguild(vm); });
-  vm.registerExternalFunction("wld_setguildattitude",[this](Daedalus::DaedalusVM& vm){ wld_setguildattitude(vm);     });
-  vm.registerExternalFunction("wld_getguildattitude",[this](Daedalus::DaedalusVM& vm){ wld_getguildattitude(vm);     });
-  vm.registerExternalFunction("wld_istime",          [this](Daedalus::DaedalusVM& vm){ wld_istime(vm);               });
-  vm.registerExternalFunction("wld_isfpavailable",   [this](Daedalus::DaedalusVM& vm){ wld_isfpavailable(vm);        });
-  vm.registerExternalFunction("wld_isnextfpavailable",
-                                                     [this](Daedalus::DaedalusVM& vm){ wld_isnextfpavailable(vm);    });
-  vm.registerExternalFunction("wld_ismobavailable",  [this](Daedalus::DaedalusVM& vm){ wld_ismobavailable(vm);       });
-  vm.registerExternalFunction("wld_setmobroutine",   [this](Daedalus::DaedalusVM& vm){ wld_setmobroutine(vm);        });
-  vm.registerExternalFunction("wld_getmobstate",     [this](Daedalus::DaedalusVM& vm){ wld_getmobstate(vm);          });
-  vm.registerExternalFunction("wld_assignroomtoguild",
-                                                     [this](Daedalus::DaedalusVM& vm){ wld_assignroomtoguild(vm);    });
-  vm.registerExternalFunction("wld_detectnpc",       [this](Daedalus::DaedalusVM& vm){ wld_detectnpc(vm);            });
-  vm.registerExternalFunction("wld_detectnpcex",     [this](Daedalus::DaedalusVM& vm){ wld_detectnpcex(vm);          });
-  vm.registerExternalFunction("wld_detectitem",      [this](Daedalus::DaedalusVM& vm){ wld_detectitem(vm);           });
-  vm.registerExternalFunction("wld_spawnnpcrange",   [this](Daedalus::DaedalusVM& vm){ wld_spawnnpcrange(vm);        });
-
-  vm.registerExternalFunction("mdl_setvisual",       [this](Daedalus::DaedalusVM& vm){ mdl_setvisual(vm);        });
-  vm.registerExternalFunction("mdl_setvisualbody",   [this](Daedalus::DaedalusVM& vm){ mdl_setvisualbody(vm);    });
-  vm.registerExternalFunction("mdl_setmodelfatness", [this](Daedalus::DaedalusVM& vm){ mdl_setmodelfatness(vm);  });
-  vm.registerExternalFunction("mdl_applyoverlaymds", [this](Daedalus::DaedalusVM& vm){ mdl_applyoverlaymds(vm);  });
-  vm.registerExternalFunction("mdl_applyoverlaymdstimed",
-                                                     [this](Daedalus::DaedalusVM& vm){ mdl_applyoverlaymdstimed(vm); });
-  vm.registerExternalFunction("mdl_removeoverlaymds",[this](Daedalus::DaedalusVM& vm){ mdl_removeoverlaymds(vm); });
-  vm.registerExternalFunction("mdl_setmodelscale",   [this](Daedalus::DaedalusVM& vm){ mdl_setmodelscale(vm);    });
-  vm.registerExternalFunction("mdl_startfaceani",    [this](Daedalus::DaedalusVM& vm){ mdl_startfaceani(vm);     });
-  vm.registerExternalFunction("mdl_applyrandomani",  [this](Daedalus::DaedalusVM& vm){ mdl_applyrandomani(vm);   });
-  vm.registerExternalFunction("mdl_applyrandomanifreq",
-                                                     [this](Daedalus::DaedalusVM& vm){ mdl_applyrandomanifreq(vm);});
-
-  vm.registerExternalFunction("npc_settofightmode",  [this](Daedalus::DaedalusVM& vm){ npc_settofightmode(vm);   });
-  vm.registerExternalFunction("npc_settofistmode",   [this](Daedalus::DaedalusVM& vm){ npc_settofistmode(vm);    });
-  vm.registerExternalFunction("npc_isinstate",       [this](Daedalus::DaedalusVM& vm){ npc_isinstate(vm);        });
-  vm.registerExternalFunction("npc_wasinstate",      [this](Daedalus::DaedalusVM& vm){ npc_wasinstate(vm);       });
-  vm.registerExternalFunction("npc_getdisttowp",     [this](Daedalus::DaedalusVM& vm){ npc_getdisttowp(vm);      });
-  vm.registerExternalFunction("npc_exchangeroutine", [this](Daedalus::DaedalusVM& vm){ npc_exchangeroutine(vm);  });
-  vm.registerExternalFunction("npc_isdead",          [this](Daedalus::DaedalusVM& vm){ npc_isdead(vm);           });
-  vm.registerExternalFunction("npc_knowsinfo",       [this](Daedalus::DaedalusVM& vm){ npc_knowsinfo(vm);        });
-  vm.registerExternalFunction("npc_settalentskill",  [this](Daedalus::DaedalusVM& vm){ npc_settalentskill(vm);   });
-  vm.registerExternalFunction("npc_gettalentskill",  [this](Daedalus::DaedalusVM& vm){ npc_gettalentskill(vm);   });
-  vm.registerExternalFunction("npc_settalentvalue",  [this](Daedalus::DaedalusVM& vm){ npc_settalentvalue(vm);   });
-  vm.registerExternalFunction("npc_gettalentvalue",  [this](Daedalus::DaedalusVM& vm){ npc_gettalentvalue(vm);   });
-  vm.registerExternalFunction("npc_setrefusetalk",   [this](Daedalus::DaedalusVM& vm){ npc_setrefusetalk(vm);    });
-  vm.registerExternalFunction("npc_refusetalk",      [this](Daedalus::DaedalusVM& vm){ npc_refusetalk(vm);       });
-  vm.registerExternalFunction("npc_hasitems",        [this](Daedalus::DaedalusVM& vm){ npc_hasitems(vm);         });
-  vm.registerExternalFunction("npc_getinvitem",      [this](Daedalus::DaedalusVM& vm){ npc_getinvitem(vm);       });
-  vm.registerExternalFunction("npc_removeinvitem",   [this](Daedalus::DaedalusVM& vm){ npc_removeinvitem(vm);    });
-  vm.registerExternalFunction("npc_removeinvitems",  [this](Daedalus::DaedalusVM& vm){ npc_removeinvitems(vm);   });
-  vm.registerExternalFunction("npc_getbodystate",    [this](Daedalus::DaedalusVM& vm){ npc_getbodystate(vm);     });
-  vm.registerExternalFunction("npc_getlookattarget", [this](Daedalus::DaedalusVM& vm){ npc_getlookattarget(vm);  });
-  vm.registerExternalFunction("npc_getdisttonpc",    [this](Daedalus::DaedalusVM& vm){ npc_getdisttonpc(vm);     });
-  vm.registerExternalFunction("npc_hasequippedarmor",[this](Daedalus::DaedalusVM& vm){ npc_hasequippedarmor(vm); });
-  vm.registerExternalFunction("npc_setperctime",     [this](Daedalus::DaedalusVM& vm){ npc_setperctime(vm);      });
-  vm.registerExternalFunction("npc_percenable",      [this](Daedalus::DaedalusVM& vm){ npc_percenable(vm);       });
-  vm.registerExternalFunction("npc_percdisable",     [this](Daedalus::DaedalusVM& vm){ npc_percdisable(vm);      });
-  vm.registerExternalFunction("npc_getnearestwp",    [this](Daedalus::DaedalusVM& vm){ npc_getnearestwp(vm);     });
-  vm.registerExternalFunction("npc_clearaiqueue",    [this](Daedalus::DaedalusVM& vm){ npc_clearaiqueue(vm);     });
-  vm.registerExternalFunction("npc_isplayer",        [this](Daedalus::DaedalusVM& vm){ npc_isplayer(vm);         });
-  vm.registerExternalFunction("npc_getstatetime",    [this](Daedalus::DaedalusVM& vm){ npc_getstatetime(vm);     });
-  vm.registerExternalFunction("npc_setstatetime",    [this](Daedalus::DaedalusVM& vm){ npc_setstatetime(vm);     });
-  vm.registerExternalFunction("npc_changeattribute", [this](Daedalus::DaedalusVM& vm){ npc_changeattribute(vm);  });
-  vm.registerExternalFunction("npc_isonfp",          [this](Daedalus::DaedalusVM& vm){ npc_isonfp(vm);           });
-  vm.registerExternalFunction("npc_getheighttonpc",  [this](Daedalus::DaedalusVM& vm){ npc_getheighttonpc(vm);   });
-  vm.registerExternalFunction("npc_getequippedmeleeweapon",
-                                                     [this](Daedalus::DaedalusVM& vm){ npc_getequippedmeleeweapon(vm); });
-  vm.registerExternalFunction("npc_getequippedrangedweapon",
-                                                     [this](Daedalus::DaedalusVM& vm){ npc_getequippedrangedweapon(vm); });
-  vm.registerExternalFunction("npc_getequippedarmor",[this](Daedalus::DaedalusVM& vm){ npc_getequippedarmor(vm); });
-  vm.registerExternalFunction("npc_canseenpc",       [this](Daedalus::DaedalusVM& vm){ npc_canseenpc(vm);        });
-  vm.registerExternalFunction("npc_hasequippedweapon",
-                                                     [this](Daedalus::DaedalusVM& vm){ npc_hasequippedweapon(vm); });
-  vm.registerExternalFunction("npc_hasequippedmeleeweapon",
-                                                     [this](Daedalus::DaedalusVM& vm){ npc_hasequippedmeleeweapon(vm); });
-  vm.registerExternalFunction("npc_hasequippedrangedweapon",
-                                                     [this](Daedalus::DaedalusVM& vm){ npc_hasequippedrangedweapon(vm); });
-  vm.registerExternalFunction("npc_getactivespell",  [this](Daedalus::DaedalusVM& vm){ npc_getactivespell(vm);   });
-  vm.registerExternalFunction("npc_getactivespellisscroll",
-                                                     [this](Daedalus::DaedalusVM& vm){ npc_getactivespellisscroll(vm); });
-  vm.registerExternalFunction("npc_getactivespellcat",
-                                                     [this](Daedalus::DaedalusVM& vm){ npc_getactivespellcat(vm); });
-  vm.registerExternalFunction("npc_setactivespellinfo",
-                                                     [this](Daedalus::DaedalusVM& vm){ npc_setactivespellinfo(vm); });
-
-  vm.registerExternalFunction("npc_canseenpcfreelos",[this](Daedalus::DaedalusVM& vm){ npc_canseenpcfreelos(vm); });
-  vm.registerExternalFunction("npc_isinfightmode",   [this](Daedalus::DaedalusVM& vm){ npc_isinfightmode(vm);    });
-  vm.registerExternalFunction("npc_settarget",       [this](Daedalus::DaedalusVM& vm){ npc_settarget(vm);        });
-  vm.registerExternalFunction("npc_gettarget",       [this](Daedalus::DaedalusVM& vm){ npc_gettarget(vm);        });
-  vm.registerExternalFunction("npc_getnexttarget",   [this](Daedalus::DaedalusVM& vm){ npc_getnexttarget(vm);    });
-  vm.registerExternalFunction("npc_sendpassiveperc", [this](Daedalus::DaedalusVM& vm){ npc_sendpassiveperc(vm);  });
-  vm.registerExternalFunction("npc_checkinfo",       [this](Daedalus::DaedalusVM& vm){ npc_checkinfo(vm);        });
-  vm.registerExternalFunction("npc_getportalguild",  [this](Daedalus::DaedalusVM& vm){ npc_getportalguild(vm);   });
-  vm.registerExternalFunction("npc_isinplayersroom", [this](Daedalus::DaedalusVM& vm){ npc_isinplayersroom(vm);  });
-  vm.registerExternalFunction("npc_getreadiedweapon",[this](Daedalus::DaedalusVM& vm){ npc_getreadiedweapon(vm); });
-  vm.registerExternalFunction("npc_hasreadiedmeleeweapon",
-                                                     [this](Daedalus::DaedalusVM& vm){ npc_hasreadiedmeleeweapon(vm); });
-  vm.registerExternalFunction("npc_isdrawingspell",  [this](Daedalus::DaedalusVM& vm){ npc_isdrawingspell(vm);   });
-  vm.registerExternalFunction("npc_isdrawingweapon", [this](Daedalus::DaedalusVM& vm){ npc_isdrawingweapon(vm);  });
-  vm.registerExternalFunction("npc_perceiveall",     [this](Daedalus::DaedalusVM& vm){ npc_perceiveall(vm);      });
-  vm.registerExternalFunction("npc_stopani",         [this](Daedalus::DaedalusVM& vm){ npc_stopani(vm);          });
-  vm.registerExternalFunction("npc_settrueguild",    [this](Daedalus::DaedalusVM& vm){ npc_settrueguild(vm);     });
-  vm.registerExternalFunction("npc_gettrueguild",    [this](Daedalus::DaedalusVM& vm){ npc_gettrueguild(vm);     });
-  vm.registerExternalFunction("npc_clearinventory",  [this](Daedalus::DaedalusVM& vm){ npc_clearinventory(vm);   });
-  vm.registerExternalFunction("npc_getattitude",     [this](Daedalus::DaedalusVM& vm){ npc_getattitude(vm);      });
-  vm.registerExternalFunction("npc_getpermattitude", [this](Daedalus::DaedalusVM& vm){ npc_getpermattitude(vm);  });
-  vm.registerExternalFunction("npc_setattitude",     [this](Daedalus::DaedalusVM& vm){ npc_setattitude(vm);      });
-  vm.registerExternalFunction("npc_settempattitude", [this](Daedalus::DaedalusVM& vm){ npc_settempattitude(vm);  });
-  vm.registerExternalFunction("npc_hasbodyflag",     [this](Daedalus::DaedalusVM& vm){ npc_hasbodyflag(vm);      });
-  vm.registerExternalFunction("npc_getlasthitspellid",
-                                                     [this](Daedalus::DaedalusVM& vm){ npc_getlasthitspellid(vm);});
-  vm.registerExternalFunction("npc_getlasthitspellcat",
-                                                     [this](Daedalus::DaedalusVM& vm){ npc_getlasthitspellcat(vm);});
-  vm.registerExternalFunction("npc_playani",         [this](Daedalus::DaedalusVM& vm){ npc_playani(vm);          });
-
-  vm.registerExternalFunction("npc_isdetectedmobownedbynpc",
-                                                     [this](Daedalus::DaedalusVM& vm){ npc_isdetectedmobownedbynpc(vm);});
-  vm.registerExternalFunction("npc_getdetectedmob",  [this](Daedalus::DaedalusVM& vm){ npc_getdetectedmob(vm);   });
-  vm.registerExternalFunction("npc_ownedbynpc",      [this](Daedalus::DaedalusVM& vm){ npc_ownedbynpc(vm);       });
-  vm.registerExternalFunction("npc_canseesource",    [this](Daedalus::DaedalusVM& vm){ npc_canseesource(vm);     });
-
-  vm.registerExternalFunction("ai_output",           [this](Daedalus::DaedalusVM& vm){ ai_output(vm);            });
-  vm.registerExternalFunction("ai_stopprocessinfos", [this](Daedalus::DaedalusVM& vm){ ai_stopprocessinfos(vm);  });
-  vm.registerExternalFunction("ai_processinfos",     [this](Daedalus::DaedalusVM& vm){ ai_processinfos(vm);      });
-  vm.registerExternalFunction("ai_standup",          [this](Daedalus::DaedalusVM& vm){ ai_standup(vm);           });
-  vm.registerExternalFunction("ai_standupquick",     [this](Daedalus::DaedalusVM& vm){ ai_standupquick(vm);      });
-  vm.registerExternalFunction("ai_continueroutine",  [this](Daedalus::DaedalusVM& vm){ ai_continueroutine(vm);   });
-  vm.registerExternalFunction("ai_stoplookat",       [this](Daedalus::DaedalusVM& vm){ ai_stoplookat(vm);        });
-  vm.registerExternalFunction("ai_lookatnpc",        [this](Daedalus::DaedalusVM& vm){ ai_lookatnpc(vm);         });
-  vm.registerExternalFunction("ai_removeweapon",     [this](Daedalus::DaedalusVM& vm){ ai_removeweapon(vm);      });
-  vm.registerExternalFunction("ai_turntonpc",        [this](Daedalus::DaedalusVM& vm){ ai_turntonpc(vm);         });
-  vm.registerExternalFunction("ai_outputsvm",        [this](Daedalus::DaedalusVM& vm){ ai_outputsvm(vm);         });
-  vm.registerExternalFunction("ai_outputsvm_overlay",[this](Daedalus::DaedalusVM& vm){ ai_outputsvm_overlay(vm); });
-  vm.registerExternalFunction("ai_startstate",       [this](Daedalus::DaedalusVM& vm){ ai_startstate(vm);        });
-  vm.registerExternalFunction("ai_playani",          [this](Daedalus::DaedalusVM& vm){ ai_playani(vm);           });
-  vm.registerExternalFunction("ai_setwalkmode",      [this](Daedalus::DaedalusVM& vm){ ai_setwalkmode(vm);       });
-  vm.registerExternalFunction("ai_wait",             [this](Daedalus::DaedalusVM& vm){ ai_wait(vm);              });
-  vm.registerExternalFunction("ai_waitms",           [this](Daedalus::DaedalusVM& vm){ ai_waitms(vm);            });
-  vm.registerExternalFunction("ai_aligntowp",        [this](Daedalus::DaedalusVM& vm){ ai_aligntowp(vm);         });
-  vm.registerExternalFunction("ai_gotowp",           [this](Daedalus::DaedalusVM& vm){ ai_gotowp(vm);            });
-  vm.registerExternalFunction("ai_gotofp",           [this](Daedalus::DaedalusVM& vm){ ai_gotofp(vm);            });
-  vm.registerExternalFunction("ai_playanibs",        [this](Daedalus::DaedalusVM& vm){ ai_playanibs(vm);         });
-  vm.registerExternalFunction("ai_equiparmor",       [this](Daedalus::DaedalusVM& vm){ ai_equiparmor(vm);        });
-  vm.registerExternalFunction("ai_equipbestarmor",   [this](Daedalus::DaedalusVM& vm){ ai_equipbestarmor(vm);    });
-  vm.registerExternalFunction("ai_equipbestmeleeweapon",
-                                                     [this](Daedalus::DaedalusVM& vm){ ai_equipbestmeleeweapon(vm);  });
-  vm.registerExternalFunction("ai_equipbestrangedweapon",
-                                                     [this](Daedalus::DaedalusVM& vm){ ai_equipbestrangedweapon(vm); });
-  vm.registerExternalFunction("ai_usemob",           [this](Daedalus::DaedalusVM& vm){ ai_usemob(vm);            });
-  vm.registerExternalFunction("ai_teleport",         [this](Daedalus::DaedalusVM& vm){ ai_teleport(vm);          });
-  vm.registerExternalFunction("ai_stoppointat",      [this](Daedalus::DaedalusVM& vm){ ai_stoppointat(vm);       });
-  vm.registerExternalFunction("ai_drawweapon",       [this](Daedalus::DaedalusVM& vm){ ai_drawweapon(vm);  });
-  vm.registerExternalFunction("ai_readymeleeweapon", [this](Daedalus::DaedalusVM& vm){ ai_readymeleeweapon(vm);  });
-  vm.registerExternalFunction("ai_readyrangedweapon",[this](Daedalus::DaedalusVM& vm){ ai_readyrangedweapon(vm); });
-  vm.registerExternalFunction("ai_readyspell",       [this](Daedalus::DaedalusVM& vm){ ai_readyspell(vm);        });
-  vm.registerExternalFunction("ai_attack",           [this](Daedalus::DaedalusVM& vm){ ai_atack(vm);             });
-  vm.registerExternalFunction("ai_flee",             [this](Daedalus::DaedalusVM& vm){ ai_flee(vm);              });
-  vm.registerExternalFunction("ai_dodge",            [this](Daedalus::DaedalusVM& vm){ ai_dodge(vm);             });
-  vm.registerExternalFunction("ai_unequipweapons",   [this](Daedalus::DaedalusVM& vm){ ai_unequipweapons(vm);    });
-  vm.registerExternalFunction("ai_unequiparmor",     [this](Daedalus::DaedalusVM& vm){ ai_unequiparmor(vm);      });
-  vm.registerExternalFunction("ai_gotonpc",          [this](Daedalus::DaedalusVM& vm){ ai_gotonpc(vm);           });
-  vm.registerExternalFunction("ai_gotonextfp",       [this](Daedalus::DaedalusVM& vm){ ai_gotonextfp(vm);        });
-  vm.registerExternalFunction("ai_aligntofp",        [this](Daedalus::DaedalusVM& vm){ ai_aligntofp(vm);         });
-  vm.registerExternalFunction("ai_useitem",          [this](Daedalus::DaedalusVM& vm){ ai_useitem(vm);           });
-  vm.registerExternalFunction("ai_useitemtostate",   [this](Daedalus::DaedalusVM& vm){ ai_useitemtostate(vm);    });
-  vm.registerExternalFunction("ai_setnpcstostate",   [this](Daedalus::DaedalusVM& vm){ ai_setnpcstostate(vm);    });
-  vm.registerExternalFunction("ai_finishingmove",    [this](Daedalus::DaedalusVM& vm){ ai_finishingmove(vm);     });
-
-  vm.registerExternalFunction("mob_hasitems",        [this](Daedalus::DaedalusVM& vm){ mob_hasitems(vm);         });
-
-  vm.registerExternalFunction("ta_min",              [this](Daedalus::DaedalusVM& vm){ ta_min(vm);               });
-
-  vm.registerExternalFunction("log_createtopic",     [this](Daedalus::DaedalusVM& vm){ log_createtopic(vm);      });
-  vm.registerExternalFunction("log_settopicstatus",  [this](Daedalus::DaedalusVM& vm){ log_settopicstatus(vm);   });
-  vm.registerExternalFunction("log_addentry",        [this](Daedalus::DaedalusVM& vm){ log_addentry(vm);         });
-
-  vm.registerExternalFunction("equipitem",           [this](Daedalus::DaedalusVM& vm){ equipitem(vm);            });
-  vm.registerExternalFunction("createinvitem",       [this](Daedalus::DaedalusVM& vm){ createinvitem(vm);        });
-  vm.registerExternalFunction("createinvitems",      [this](Daedalus::DaedalusVM& vm){ createinvitems(vm);       });
-
-  vm.registerExternalFunction("info_addchoice",      [this](Daedalus::DaedalusVM& vm){ info_addchoice(vm);       });
-  vm.registerExternalFunction("info_clearchoices",   [this](Daedalus::DaedalusVM& vm){ info_clearchoices(vm);    });
-  vm.registerExternalFunction("infomanager_hasfinished",
-                                                     [this](Daedalus::DaedalusVM& vm){ infomanager_hasfinished(vm); });
-
-  vm.registerExternalFunction("snd_play",            [this](Daedalus::DaedalusVM& vm){ snd_play(vm);             });
-  vm.registerExternalFunction("snd_play3d",          [this](Daedalus::DaedalusVM& vm){ snd_play3d(vm);           });
-
-  vm.registerExternalFunction("game_initgerman",     [this](Daedalus::DaedalusVM& vm){ game_initgerman(vm);      });
-  vm.registerExternalFunction("game_initenglish",    [this](Daedalus::DaedalusVM& vm){ game_initenglish(vm);     });
-
-  vm.registerExternalFunction("exitsession",         [this](Daedalus::DaedalusVM& vm){ exitsession(vm);          });
+  bindExternal("hlp_random",          [this](Daedalus::DaedalusVM& vm){ hlp_random(vm);         });
+  bindExternal("hlp_isvalidnpc",      [this](Daedalus::DaedalusVM& vm){ hlp_isvalidnpc(vm);     });
+  bindExternal("hlp_isvaliditem",     [this](Daedalus::DaedalusVM& vm){ hlp_isvaliditem(vm);    });
+  bindExternal("hlp_isitem",          [this](Daedalus::DaedalusVM& vm){ hlp_isitem(vm);         });
+  bindExternal("hlp_getnpc",          [this](Daedalus::DaedalusVM& vm){ hlp_getnpc(vm);         });
+  bindExternal("hlp_getinstanceid",   [this](Daedalus::DaedalusVM& vm){ hlp_getinstanceid(vm);  });
+
+  bindExternal("wld_insertnpc",       [this](Daedalus::DaedalusVM& vm){ wld_insertnpc(vm);  });
+  bindExternal("wld_insertitem",      [this](Daedalus::DaedalusVM& vm){ wld_insertitem(vm); });
+  bindExternal("wld_settime",         [this](Daedalus::DaedalusVM& vm){ wld_settime(vm);    });
+  bindExternal("wld_getday",          [this](Daedalus::DaedalusVM& vm){ wld_getday(vm);     });
+  bindExternal("wld_playeffect",      [this](Daedalus::DaedalusVM& vm){ wld_playeffect(vm); });
+  bindExternal("wld_stopeffect",      [this](Daedalus::DaedalusVM& vm){ wld_stopeffect(vm); });
+  bindExternal("wld_getplayerportalguild",
+                                      [this](Daedalus::DaedalusVM& vm){ wld_getplayerportalguild(vm); });
+  bindExternal("wld_setguildattitude",[this](Daedalus::DaedalusVM& vm){ wld_setguildattitude(vm);     });
+  bindExternal("wld_getguildattitude",[this](Daedalus::DaedalusVM& vm){ wld_getguildattitude(vm);     });
+  bindExternal("wld_istime",          [this](Daedalus::DaedalusVM& vm){ wld_istime(vm);               });
+  bindExternal("wld_isfpavailable",   [this](Daedalus::DaedalusVM& vm){ wld_isfpavailable(vm);        });
+  bindExternal("wld_isnextfpavailable",
+                                      [this](Daedalus::DaedalusVM& vm){ wld_isnextfpavailable(vm);    });
+  bindExternal("wld_ismobavailable",  [this](Daedalus::DaedalusVM& vm){ wld_ismobavailable(vm);       });
+  bindExternal("wld_setmobroutine",   [this](Daedalus::DaedalusVM& vm){ wld_setmobroutine(vm);        });
+  bindExternal("wld_getmobstate",     [this](Daedalus::DaedalusVM& vm){ wld_getmobstate(vm);          });
+  bindExternal("wld_assignroomtoguild",
+                                      [this](Daedalus::DaedalusVM& vm){ wld_assignroomtoguild(vm);    });
+  bindExternal("wld_detectnpc",       [this](Daedalus::DaedalusVM& vm){ wld_detectnpc(vm);            });
+  bindExternal("wld_detectnpcex",     [this](Daedalus::DaedalusVM& vm){ wld_detectnpcex(vm);          });
+  bindExternal("wld_detectitem",      [this](Daedalus::DaedalusVM& vm){ wld_detectitem(vm);           });
+  bindExternal("wld_spawnnpcrange",   [this](Daedalus::DaedalusVM& vm){ wld_spawnnpcrange(vm);        });
+
+  bindExternal("mdl_setvisual",       [this](Daedalus::DaedalusVM& vm){ mdl_setvisual(vm);        });
+  bindExternal("mdl_setvisualbody",   [this](Daedalus::DaedalusVM& vm){ mdl_setvisualbody(vm);    });
+  bindExternal("mdl_setmodelfatness", [this](Daedalus::DaedalusVM& vm){ mdl_setmodelfatness(vm);  });
+  bindExternal("mdl_applyoverlaymds", [this](Daedalus::DaedalusVM& vm){ mdl_applyoverlaymds(vm);  });
+  bindExternal("mdl_applyoverlaymdstimed",
+                                      [this](Daedalus::DaedalusVM& vm){ mdl_applyoverlaymdstimed(vm); });
+  bindExternal("mdl_removeoverlaymds",[this](Daedalus::DaedalusVM& vm){ mdl_removeoverlaymds(vm); });
+  bindExternal("mdl_setmodelscale",   [this](Daedalus::DaedalusVM& vm){ mdl_setmodelscale(vm);    });
+  bindExternal("mdl_startfaceani",    [this](Daedalus::DaedalusVM& vm){ mdl_startfaceani(vm);     });
+  bindExternal("mdl_applyrandomani",  [this](Daedalus::DaedalusVM& vm){ mdl_applyrandomani(vm);   });
+  bindExternal("mdl_applyrandomanifreq",
+                                      [this](Daedalus::DaedalusVM& vm){ mdl_applyrandomanifreq(vm);});
+
+  bindExternal("npc_settofightmode",  [this](Daedalus::DaedalusVM& vm){ npc_settofightmode(vm);   });
+  bindExternal("npc_settofistmode",   [this](Daedalus::DaedalusVM& vm){ npc_settofistmode(vm);    });
+  bindExternal("npc_isinstate",       [this](Daedalus::DaedalusVM& vm){ npc_isinstate(vm);        });
+  bindExternal("npc_wasinstate",      [this](Daedalus::DaedalusVM& vm){ npc_wasinstate(vm);       });
+  bindExternal("npc_getdisttowp",     [this](Daedalus::DaedalusVM& vm){ npc_getdisttowp(vm);      });
+  bindExternal("npc_exchangeroutine", [this](Daedalus::DaedalusVM& vm){ npc_exchangeroutine(vm);  });
+  bindExternal("npc_isdead",          [this](Daedalus::DaedalusVM& vm){ npc_isdead(vm);           });
+  bindExternal("npc_knowsinfo",       [this](Daedalus::DaedalusVM& vm){ npc_knowsinfo(vm);        });
+  bindExternal("npc_settalentskill",  [this](Daedalus::DaedalusVM& vm){ npc_settalentskill(vm);   });
+  bindExternal("npc_gettalentskill",  [this](Daedalus::DaedalusVM& vm){ npc_gettalentskill(vm);   });
+  bindExternal("npc_settalentvalue",  [this](Daedalus::DaedalusVM& vm){ npc_settalentvalue(vm);   });
+  bindExternal("npc_gettalentvalue",  [this](Daedalus::DaedalusVM& vm){ npc_gettalentvalue(vm);   });
+  bindExternal("npc_setrefusetalk",   [this](Daedalus::DaedalusVM& vm){ npc_setrefusetalk(vm);    });
+  bindExternal("npc_refusetalk",      [this](Daedalus::DaedalusVM& vm){ npc_refusetalk(vm);       });
+  bindExternal("npc_hasitems",        [this](Daedalus::DaedalusVM& vm){ npc_hasitems(vm);         });
+  bindExternal("npc_getinvitem",      [this](Daedalus::DaedalusVM& vm){ npc_getinvitem(vm);       });
+  bindExternal("npc_removeinvitem",   [this](Daedalus::DaedalusVM& vm){ npc_removeinvitem(vm);    });
+  bindExternal("npc_removeinvitems",  [this](Daedalus::DaedalusVM& vm){ npc_removeinvitems(vm);   });
+  bindExternal("npc_getbodystate",    [this](Daedalus::DaedalusVM& vm){ npc_getbodystate(vm);     });
+  bindExternal("npc_getlookattarget", [this](Daedalus::DaedalusVM& vm){ npc_getlookattarget(vm);  });
+  bindExternal("npc_getdisttonpc",    [this](Daedalus::DaedalusVM& vm){ npc_getdisttonpc(vm);     });
+  bindExternal("npc_hasequippedarmor",[this](Daedalus::DaedalusVM& vm){ npc_hasequippedarmor(vm); });
+  bindExternal("npc_setperctime",     [this](Daedalus::DaedalusVM& vm){ npc_setperctime(vm);      });
+  bindExternal("npc_percenable",      [this](Daedalus::DaedalusVM& vm){ npc_percenable(vm);       });
+  bindExternal("npc_percdisable",     [this](Daedalus::DaedalusVM& vm){ npc_percdisable(vm);      });
+  bindExternal("npc_getnearestwp",    [this](Daedalus::DaedalusVM& vm){ npc_getnearestwp(vm);     });
+  bindExternal("npc_clearaiqueue",    [this](Daedalus::DaedalusVM& vm){ npc_clearaiqueue(vm);     });
+  bindExternal("npc_isplayer",        [this](Daedalus::DaedalusVM& vm){ npc_isplayer(vm);         });
+  bindExternal("npc_getstatetime",    [this](Daedalus::DaedalusVM& vm){ npc_getstatetime(vm);     });
+  bindExternal("npc_setstatetime",    [this](Daedalus::DaedalusVM& vm){ npc_setstatetime(vm);     });
+  bindExternal("npc_changeattribute", [this](Daedalus::DaedalusVM& vm){ npc_changeattribute(vm);  });
+  bindExternal("npc_isonfp",          [this](Daedalus::DaedalusVM& vm){ npc_isonfp(vm);           });
+  bindExternal("npc_getheighttonpc",  [this](Daedalus::DaedalusVM& vm){ npc_getheighttonpc(vm);   });
+  bindExternal("npc_getequippedmeleeweapon",
+                                      [this](Daedalus::DaedalusVM& vm){ npc_getequippedmeleeweapon(vm); });
+  bindExternal("npc_getequippedrangedweapon",
+                                      [this](Daedalus::DaedalusVM& vm){ npc_getequippedrangedweapon(vm); });
+  bindExternal("npc_getequippedarmor",[this](Daedalus::DaedalusVM& vm){ npc_getequippedarmor(vm); });
+  bindExternal("npc_canseenpc",       [this](Daedalus::DaedalusVM& vm){ npc_canseenpc(vm);        });
+  bindExternal("npc_hasequippedweapon",
+                                      [this](Daedalus::DaedalusVM& vm){ npc_hasequippedweapon(vm); });
+  bindExternal("npc_hasequippedmeleeweapon",
+                                      [this](Daedalus::DaedalusVM& vm){ npc_hasequippedmeleeweapon(vm); });
+  bindExternal("npc_hasequippedrangedweapon",
+                                      [this](Daedalus::DaedalusVM& vm){ npc_hasequippedrangedweapon(vm); });
+  bindExternal("npc_getactivespell",  [this](Daedalus::DaedalusVM& vm){ npc_getactivespell(vm);   });
+  bindExternal("npc_getactivespellisscroll",
+                                      [this](Daedalus::DaedalusVM& vm){ npc_getactivespellisscroll(vm); });
+  bindExternal("npc_getactivespellcat",
+                                      [this](Daedalus::DaedalusVM& vm){ npc_getactivespellcat(vm); });
+  bindExternal("npc_setactivespellinfo",
+                                      [this](Daedalus::DaedalusVM& vm){ npc_setactivespellinfo(vm); });
+
+  bindExternal("npc_canseenpcfreelos",[this](Daedalus::DaedalusVM& vm){ npc_canseenpcfreelos(vm); });
+  bindExternal("npc_isinfightmode",   [this](Daedalus::DaedalusVM& vm){ npc_isinfightmode(vm);    });
+  bindExternal("npc_settarget",       [this](Daedalus::DaedalusVM& vm){ npc_settarget(vm);        });
+  bindExternal("npc_gettarget",       [this](Daedalus::DaedalusVM& vm){ npc_gettarget(vm);        });
+  bindExternal("npc_getnexttarget",   [this](Daedalus::DaedalusVM& vm){ npc_getnexttarget(vm);    });
+  bindExternal("npc_sendpassiveperc", [this](Daedalus::DaedalusVM& vm){ npc_sendpassiveperc(vm);  });
+  bindExternal("npc_checkinfo",       [this](Daedalus::DaedalusVM& vm){ npc_checkinfo(vm);        });
+  bindExternal("npc_getportalguild",  [this](Daedalus::DaedalusVM& vm){ npc_getportalguild(vm);   });
+  bindExternal("npc_isinplayersroom", [this](Daedalus::DaedalusVM& vm){ npc_isinplayersroom(vm);  });
+  bindExternal("npc_getreadiedweapon",[this](Daedalus::DaedalusVM& vm){ npc_getreadiedweapon(vm); });
+  bindExternal("npc_hasreadiedmeleeweapon",
+                                      [this](Daedalus::DaedalusVM& vm){ npc_hasreadiedmeleeweapon(vm); });
+  bindExternal("npc_isdrawingspell",  [this](Daedalus::DaedalusVM& vm){ npc_isdrawingspell(vm);   });
+  bindExternal("npc_isdrawingweapon", [this](Daedalus::DaedalusVM& vm){ npc_isdrawingweapon(vm);  });
+  bindExternal("npc_perceiveall",     [this](Daedalus::DaedalusVM& vm){ npc_perceiveall(vm);      });
+  bindExternal("npc_stopani",         [this](Daedalus::DaedalusVM& vm){ npc_stopani(vm);          });
+  bindExternal("npc_settrueguild",    [this](Daedalus::DaedalusVM& vm){ npc_settrueguild(vm);     });
+  bindExternal("npc_gettrueguild",    [this](Daedalus::DaedalusVM& vm){ npc_gettrueguild(vm);     });
+  bindExternal("npc_clearinventory",  [this](Daedalus::DaedalusVM& vm){ npc_clearinventory(vm);   });
+  bindExternal("npc_getattitude",     [this](Daedalus::DaedalusVM& vm){ npc_getattitude(vm);      });
+  bindExternal("npc_getpermattitude", [this](Daedalus::DaedalusVM& vm){ npc_getpermattitude(vm);  });
+  bindExternal("npc_setattitude",     [this](Daedalus::DaedalusVM& vm){ npc_setattitude(vm);      });
+  bindExternal("npc_settempattitude", [this](Daedalus::DaedalusVM& vm){ npc_settempattitude(vm);  });
+  bindExternal("npc_hasbodyflag",     [this](Daedalus::DaedalusVM& vm){ npc_hasbodyflag(vm);      });
+  bindExternal("npc_getlasthitspellid",
+                                      [this](Daedalus::DaedalusVM& vm){ npc_getlasthitspellid(vm);});
+  bindExternal("npc_getlasthitspellcat",
+                                      [this](Daedalus::DaedalusVM& vm){ npc_getlasthitspellcat(vm);});
+  bindExternal("npc_playani",         [this](Daedalus::DaedalusVM& vm){ npc_playani(vm);          });
+
+  bindExternal("npc_isdetectedmobownedbynpc",
+                                      [this](Daedalus::DaedalusVM& vm){ npc_isdetectedmobownedbynpc(vm);});
+  bindExternal("npc_getdetectedmob",  [this](Daedalus::DaedalusVM& vm){ npc_getdetectedmob(vm);   });
+  bindExternal("npc_ownedbynpc",      [this](Daedalus::DaedalusVM& vm){ npc_ownedbynpc(vm);       });
+  bindExternal("npc_canseesource",    [this](Daedalus::DaedalusVM& vm){ npc_canseesource(vm);     });
+
+  bindExternal("ai_output",           [this](Daedalus::DaedalusVM& vm){ ai_output(vm);            });
+  bindExternal("ai_stopprocessinfos", [this](Daedalus::DaedalusVM& vm){ ai_stopprocessinfos(vm);  });
+  bindExternal("ai_processinfos",     [this](Daedalus::DaedalusVM& vm){ ai_processinfos(vm);      });
+  bindExternal("ai_standup",          [this](Daedalus::DaedalusVM& vm){ ai_standup(vm);           });
+  bindExternal("ai_standupquick",     [this](Daedalus::DaedalusVM& vm){ ai_standupquick(vm);      });
+  bindExternal("ai_continueroutine",  [this](Daedalus::DaedalusVM& vm){ ai_continueroutine(vm);   });
+  bindExternal("ai_stoplookat",       [this](Daedalus::DaedalusVM& vm){ ai_stoplookat(vm);        });
+  bindExternal("ai_lookatnpc",        [this](Daedalus::DaedalusVM& vm){ ai_lookatnpc(vm);         });
+  bindExternal("ai_removeweapon",     [this](Daedalus::DaedalusVM& vm){ ai_removeweapon(vm);      });
+  bindExternal("ai_turntonpc",        [this](Daedalus::DaedalusVM& vm){ ai_turntonpc(vm);         });
+  bindExternal("ai_outputsvm",        [this](Daedalus::DaedalusVM& vm){ ai_outputsvm(vm);         });
+  bindExternal("ai_outputsvm_overlay",[this](Daedalus::DaedalusVM& vm){ ai_outputsvm_overlay(vm); });
+  bindExternal("ai_startstate",       [this](Daedalus::DaedalusVM& vm){ ai_startstate(vm);        });
+  bindExternal("ai_playani",          [this](Daedalus::DaedalusVM& vm){ ai_playani(vm);           });
+  bindExternal("ai_setwalkmode",      [this](Daedalus::DaedalusVM& vm){ ai_setwalkmode(vm);       });
+  bindExternal("ai_wait",             [this](Daedalus::DaedalusVM& vm){ ai_wait(vm);              });
+  bindExternal("ai_waitms",           [this](Daedalus::DaedalusVM& vm){ ai_waitms(vm);            });
+  bindExternal("ai_aligntowp",        [this](Daedalus::DaedalusVM& vm){ ai_aligntowp(vm);         });
+  bindExternal("ai_gotowp",           [this](Daedalus::DaedalusVM& vm){ ai_gotowp(vm);            });
+  bindExternal("ai_gotofp",           [this](Daedalus::DaedalusVM& vm){ ai_gotofp(vm);            });
+  bindExternal("ai_playanibs",        [this](Daedalus::DaedalusVM& vm){ ai_playanibs(vm);         });
+  bindExternal("ai_equiparmor",       [this](Daedalus::DaedalusVM& vm){ ai_equiparmor(vm);        });
+  bindExternal("ai_equipbestarmor",   [this](Daedalus::DaedalusVM& vm){ ai_equipbestarmor(vm);    });
+  bindExternal("ai_equipbestmeleeweapon",
+                                      [this](Daedalus::DaedalusVM& vm){ ai_equipbestmeleeweapon(vm);  });
+  bindExternal("ai_equipbestrangedweapon",
+                                      [this](Daedalus::DaedalusVM& vm){ ai_equipbestrangedweapon(vm); });
+  bindExternal("ai_usemob",           [this](Daedalus::DaedalusVM& vm){ ai_usemob(vm);            });
+  bindExternal("ai_teleport",         [this](Daedalus::DaedalusVM& vm){ ai_teleport(vm);          });
+  bindExternal("ai_stoppointat",      [this](Daedalus::DaedalusVM& vm){ ai_stoppointat(vm);       });
+  bindExternal("ai_drawweapon",       [this](Daedalus::DaedalusVM& vm){ ai_drawweapon(vm);  });
+  bindExternal("ai_readymeleeweapon", [this](Daedalus::DaedalusVM& vm){ ai_readymeleeweapon(vm);  });
+  bindExternal("ai_readyrangedweapon",[this](Daedalus::DaedalusVM& vm){ ai_readyrangedweapon(vm); });
+  bindExternal("ai_readyspell",       [this](Daedalus::DaedalusVM& vm){ ai_readyspell(vm);        });
+  bindExternal("ai_attack",           [this](Daedalus::DaedalusVM& vm){ ai_atack(vm);             });
+  bindExternal("ai_flee",             [this](Daedalus::DaedalusVM& vm){ ai_flee(vm);              });
+  bindExternal("ai_dodge",            [this](Daedalus::DaedalusVM& vm){ ai_dodge(vm);             });
+  bindExternal("ai_unequipweapons",   [this](Daedalus::DaedalusVM& vm){ ai_unequipweapons(vm);    });
+  bindExternal("ai_unequiparmor",     [this](Daedalus::DaedalusVM& vm){ ai_unequiparmor(vm);      });
+  bindExternal("ai_gotonpc",          [this](Daedalus::DaedalusVM& vm){ ai_gotonpc(vm);           });
+  bindExternal("ai_gotonextfp",       [this](Daedalus::DaedalusVM& vm){ ai_gotonextfp(vm);        });
+  bindExternal("ai_aligntofp",        [this](Daedalus::DaedalusVM& vm){ ai_aligntofp(vm);         });
+  bindExternal("ai_useitem",          [this](Daedalus::DaedalusVM& vm){ ai_useitem(vm);           });
+  bindExternal("ai_useitemtostate",   [this](Daedalus::DaedalusVM& vm){ ai_useitemtostate(vm);    });
+  bindExternal("ai_setnpcstostate",   [this](Daedalus::DaedalusVM& vm){ ai_setnpcstostate(vm);    });
+  bindExternal("ai_finishingmove",    [this](Daedalus::DaedalusVM& vm){ ai_finishingmove(vm);     });
+
+  bindExternal("mob_hasitems",        [this](Daedalus::DaedalusVM& vm){ mob_hasitems(vm);         });
+
+  bindExternal("ta_min",              [this](Daedalus::DaedalusVM& vm){ ta_min(vm);               });
+
+  bindExternal("log_createtopic",     [this](Daedalus::DaedalusVM& vm){ log_createtopic(vm);      });
+  bindExternal("log_settopicstatus",  [this](Daedalus::DaedalusVM& vm){ log_settopicstatus(vm);   });
+  bindExternal("log_addentry",        [this](Daedalus::DaedalusVM& vm){ log_addentry(vm);         });
+
+  bindExternal("equipitem",           [this](Daedalus::DaedalusVM& vm){ equipitem(vm);            });
+  bindExternal("createinvitem",       [this](Daedalus::DaedalusVM& vm){ createinvitem(vm);        });
+  bindExternal("createinvitems",      [this](Daedalus::DaedalusVM& vm){ createinvitems(vm);       });
+
+  bindExternal("info_addchoice",      [this](Daedalus::DaedalusVM& vm){ info_addchoice(vm);       });
+  bindExternal("info_clearchoices",   [this](Daedalus::DaedalusVM& vm){ info_clearchoices(vm);    });
+  bindExternal("infomanager_hasfinished",
+                                      [this](Daedalus::DaedalusVM& vm){ infomanager_hasfinished(vm); });
+
+  bindExternal("snd_play",            [this](Daedalus::DaedalusVM& vm){ snd_play(vm);             });
+  bindExternal("snd_play3d",          [this](Daedalus::DaedalusVM& vm){ snd_play3d(vm);           });
+
+  bindExternal("game_initgerman",     [this](Daedalus::DaedalusVM& vm){ game_initgerman(vm);      });
+  bindExternal("game_initenglish",    [this](Daedalus::DaedalusVM& vm){ game_initenglish(vm);     });
+
+  bindExternal("exitsession",         [this](Daedalus::DaedalusVM& vm){ exitsession(vm);          });
 
   // vm.validateExternals();
 
@@ -313,6 +329,27 @@ void GameScript::initCommon() {
   ZS_Attack            = getAiState(getSymbolIndex("ZS_Attack")).funcIni;
   ZS_MM_Attack         = getAiState(getSymbolIndex("ZS_MM_Attack")).funcIni;
 
+  // resolved once - engine callbacks don't do name lookups at runtime
+  G_CanNotUse                        = getSymbolIndex("G_CanNotUse");
+  G_CanNotCast                       = getSymbolIndex("G_CanNotCast");
+  G_PickLock                         = getSymbolIndex("G_PickLock");
+  C_CanNpcCollideWithSpell           = getSymbolIndex("C_CanNpcCollideWithSpell");
+  Spell_ProcessMana                  = getSymbolIndex("Spell_ProcessMana");
+  player_hotkey_screen_map           = getSymbolIndex("player_hotkey_screen_map");
+  player_trade_not_enough_gold       = getSymbolIndex("player_trade_not_enough_gold");
+  player_plunder_is_empty            = getSymbolIndex("player_plunder_is_empty");
+  player_mob_missing_item            = getSymbolIndex("player_mob_missing_item");
+  player_mob_missing_key             = getSymbolIndex("player_mob_missing_key");
+  player_mob_missing_lockpick        = getSymbolIndex("player_mob_missing_lockpick");
+  player_mob_missing_key_or_lockpick = getSymbolIndex("player_mob_missing_key_or_lockpick");
+  player_mob_another_is_using        = getSymbolIndex("player_mob_another_is_using");
+  NPC_DAM_DIVE_TIME                  = getSymbolIndex("NPC_DAM_DIVE_TIME");
+  ItKE_lockpick                      = getSymbolIndex("ItKE_lockpick");
+  MOB_SIT                            = getSymbolIndex("MOB_SIT");
+  MOB_LIE                            = getSymbolIndex("MOB_LIE");
+  MOB_CLIMB                          = getSymbolIndex("MOB_CLIMB");
+  MOB_NOTINTERRUPTABLE               = getSymbolIndex("MOB_NOTINTERRUPTABLE");
+
   auto& dat = vm.getDATFile();
 
   if(owner.version().game==2){
@@ -418,6 +455,10 @@ void GameScript::initDialogs(Gothic& gothic) {
     vm.initializeInstance(h, i, Daedalus::IC_Info);
     ++count;
     });
+
+  dialogsByNpc.clear();
+  for(size_t i=0;i<dialogsInfo.size();++i)
+    dialogsByNpc[dialogsInfo[i].npc].push_back(i);
   }
 
 void GameScript::loadDialogOU(Gothic &gothic) {
@@ -444,15 +485,18 @@ void GameScript::loadDialogOU(Gothic &gothic) {
   }
 
 void GameScript::initializeInstance(Daedalus::GEngineClasses::C_Npc &n, size_t instance) {
+  ScriptProfiler::Scope scope(profiler.get(),instance);
   vm.initializeInstance(n,instance,Daedalus::IC_Npc);
 
   if(n.daily_routine!=0) {
     ScopeVar self(vm,vm.globalSelf(),&n,Daedalus::IC_Npc);
+    ScriptProfiler::Scope rtn(profiler.get(),size_t(n.daily_routine));
     vm.runFunctionBySymIndex(n.daily_routine);
     }
   }
 
 void GameScript::initializeInstance(Daedalus::GEngineClasses::C_Item &it,size_t instance) {
+  ScriptProfiler::Scope scope(profiler.get(),instance);
   vm.initializeInstance(it,instance,Daedalus::IC_Item);
   }
 
@@ -462,9 +506,7 @@ void GameScript::clearReferences(Daedalus::GEngineClasses::Instance &ptr) {
 
 void GameScript::save(Serialize &fout) {
   quests.save(fout);
-  fout.write(uint32_t(dlgKnownInfos.size()));
-  for(auto& i:dlgKnownInfos)
-    fout.write(uint32_t(i.first),uint32_t(i.second));
+  dlgKnownInfos.save(fout);
 
   fout.write(uint32_t(gilAttitudes.size()));
   for(auto& i:gilAttitudes)
@@ -702,18 +744,15 @@ std::vector<GameScript::DlgChoise> GameScript::dialogChoises(Daedalus::GEngineCl
   ScopeVar self (vm, vm.globalSelf(),  hnpc,   Daedalus::IC_Npc);
   ScopeVar other(vm, vm.globalOther(), player, Daedalus::IC_Npc);
 
-  std::vector<Daedalus::GEngineClasses::C_Info*> hDialog;
-  for(auto& info : dialogsInfo) {
-    if(info.npc==int32_t(npc.instanceSymbol)) {
-      hDialog.push_back(&info);
-      }
-    }
+  auto hDialog = dialogsByNpc.find(int32_t(npc.instanceSymbol));
+  if(hDialog==dialogsByNpc.end())
+    return {};
 
   std::vector<DlgChoise> choise;
 
   for(int important=includeImp ? 1 : 0;important>=0;--important){
-    for(auto& i:hDialog) {
-      const Daedalus::GEngineClasses::C_Info& info = *i;
+    for(auto id:hDialog->second) {
+      auto& info = dialogsInfo[id];
       if(info.important!=important)
         continue;
       bool npcKnowsInfo = doesNpcKnowInfo(pl,info.instanceSymbol);
@@ -740,7 +779,7 @@ std::vector<GameScript::DlgChoise> GameScript::dialogChoises(Daedalus::GEngineCl
       DlgChoise ch;
       ch.title    = info.description.c_str();
       ch.scriptFn = info.information;
-      ch.handle   = i;
+      ch.handle   = &info;
       ch.isTrade  = info.trade!=0;
       ch.sort     = info.nr;
       choise.emplace_back(std::move(ch));
@@ -800,7 +839,7 @@ void GameScript::exec(const GameScript::DlgChoise &dlg,Npc& player, Npc& npc) {
   }
 
 int GameScript::printCannotUseError(Npc& npc, int32_t atr, int32_t nValue) {
-  auto id = vm.getDATFile().getSymbolIndexByName("G_CanNotUse");
+  auto id = G_CanNotUse;
   if(id==size_t(-1))
     return 0;
   vm.pushInt(npc.isPlayer() ? 1 : 0);
@@ -811,7 +850,7 @@ int GameScript::printCannotUseError(Npc& npc, int32_t atr, int32_t nValue) {
   }
 
 int GameScript::printCannotCastError(Npc &npc, int32_t plM, int32_t itM) {
-  auto id = vm.getDATFile().getSymbolIndexByName("G_CanNotCast");
+  auto id = G_CanNotCast;
   if(id==size_t(-1))
     return 0;
   vm.pushInt(npc.isPlayer() ? 1 : 0);
@@ -822,7 +861,7 @@ int GameScript::printCannotCastError(Npc &npc, int32_t plM, int32_t itM) {
   }
 
 int GameScript::printCannotBuyError(Npc &npc) {
-  auto id = vm.getDATFile().getSymbolIndexByName("player_trade_not_enough_gold");
+  auto id = player_trade_not_enough_gold;
   if(id==size_t(-1))
     return 0;
   ScopeVar self(vm, vm.globalSelf(), npc.handle(), Daedalus::IC_Npc);
@@ -830,7 +869,7 @@ int GameScript::printCannotBuyError(Npc &npc) {
   }
 
 int GameScript::printMobMissingItem(Npc &npc) {
-  auto id = vm.getDATFile().getSymbolIndexByName("player_mob_missing_item");
+  auto id = player_mob_missing_item;
   if(id==size_t(-1))
     return 0;
   ScopeVar self(vm, vm.globalSelf(), npc.handle(), Daedalus::IC_Npc);
@@ -838,7 +877,7 @@ int GameScript::printMobMissingItem(Npc &npc) {
   }
 
 int GameScript::printMobMissingKey(Npc& npc) {
-  auto id = vm.getDATFile().getSymbolIndexByName("player_mob_missing_key");
+  auto id = player_mob_missing_key;
   if(id==size_t(-1))
     return 0;
   ScopeVar self(vm, vm.globalSelf(), npc.handle(), Daedalus::IC_Npc);
@@ -846,7 +885,7 @@ int GameScript::printMobMissingKey(Npc& npc) {
   }
 
 int GameScript::printMobAnotherIsUsing(Npc &npc) {
-  auto id = vm.getDATFile().getSymbolIndexByName("player_mob_another_is_using");
+  auto id = player_mob_another_is_using;
   if(id==size_t(-1))
     return 0;
   ScopeVar self(vm, vm.globalSelf(), npc.handle(), Daedalus::IC_Npc);
@@ -854,7 +893,7 @@ int GameScript::printMobAnotherIsUsing(Npc &npc) {
   }
 
 int GameScript::printMobMissingKeyOrLockpick(Npc& npc) {
-  auto id = vm.getDATFile().getSymbolIndexByName("player_mob_missing_key_or_lockpick");
+  auto id = player_mob_missing_key_or_lockpick;
   if(id==size_t(-1))
     return 0;
   ScopeVar self(vm, vm.globalSelf(), npc.handle(), Daedalus::IC_Npc);
@@ -862,7 +901,7 @@ int GameScript::printMobMissingKeyOrLockpick(Npc& npc) {
   }
 
 int GameScript::printMobMissingLockpick(Npc& npc) {
-  auto id = vm.getDATFile().getSymbolIndexByName("player_mob_missing_lockpick");
+  auto id = player_mob_missing_lockpick;
   if(id==size_t(-1))
     return 0;
   ScopeVar self(vm, vm.globalSelf(), npc.handle(), Daedalus::IC_Npc);
@@ -918,8 +957,7 @@ int GameScript::invokeItem(Npc *npc, ScriptFn fn) {
   }
 
 int GameScript::invokeMana(Npc &npc, Npc* target, Item &) {
-  auto& dat = vm.getDATFile();
-  auto fn   = dat.getSymbolIndexByName("Spell_ProcessMana");
+  auto fn = Spell_ProcessMana;
   if(fn==size_t(-1))
     return Npc::SpellCode::SPL_SENDSTOP;
 
@@ -931,13 +969,18 @@ int GameScript::invokeMana(Npc &npc, Npc* target, Item &) {
   }
 
 int GameScript::invokeSpell(Npc &npc, Npc* target, Item &it) {
-  auto& spellInst = vm.getDATFile().getSymbolByIndex(spellFxInstanceNames);
-  auto& tag       = spellInst.getString(size_t(it.spellId()));
-  char  str[256]={};
-  std::snprintf(str,sizeof(str),"Spell_Cast_%s",tag.c_str());
-
-  auto& dat = vm.getDATFile();
-  auto  fn  = dat.getSymbolIndexByName(str);
+  const size_t splId = size_t(it.spellId());
+  if(splId>=spellCastFn.size())
+    spellCastFn.resize(splId+1,unresolvedFn);
+  if(spellCastFn[splId]==unresolvedFn) {
+    auto& spellInst = vm.getDATFile().getSymbolByIndex(spellFxInstanceNames);
+    auto& tag       = spellInst.getString(splId);
+    char  str[256]={};
+    std::snprintf(str,sizeof(str),"Spell_Cast_%s",tag.c_str());
+    spellCastFn[splId] = getSymbolIndex(str);
+    }
+
+  auto fn = spellCastFn[splId];
   if(fn==size_t(-1))
     return 0;
 
@@ -950,7 +993,7 @@ int GameScript::invokeSpell(Npc &npc, Npc* target, Item &it) {
     return runFunction(fn);
     }
   catch(...){
-    Log::d("unable to call spell-script: \"",str,"\'");
+    Log::d("unable to call spell-script: \"",getSymbol(fn).name,"\'");
     return 0;
     }
   }
@@ -962,8 +1005,7 @@ int GameScript::invokeCond(Npc &,const char* func) {
   }
 
 void GameScript::invokePickLock(Npc& npc, int bSuccess, int bBrokenOpen) {
-  auto& dat = vm.getDATFile();
-  auto fn   = dat.getSymbolIndexByName("G_PickLock");
+  auto fn = G_PickLock;
   if(fn==size_t(-1))
     return;
   ScopeVar self(vm, vm.globalSelf(),  npc);
@@ -973,8 +1015,7 @@ void GameScript::invokePickLock(Npc& npc, int bSuccess, int bBrokenOpen) {
   }
 
 CollideMask GameScript::canNpcCollideWithSpell(Npc& npc, Npc* shooter, int32_t spellId) {
-  auto& dat = vm.getDATFile();
-  auto fn   = dat.getSymbolIndexByName("C_CanNpcCollideWithSpell");
+  auto fn = C_CanNpcCollideWithSpell;
   if(fn==size_t(-1))
     return COLL_DOEVERYTHING;
 
@@ -986,8 +1027,7 @@ CollideMask GameScript::canNpcCollideWithSpell(Npc& npc, Npc* shooter, int32_t s
   }
 
 int GameScript::playerHotKeyScreenMap(Npc& pl) {
-  auto& dat = vm.getDATFile();
-  auto fn   = dat.getSymbolIndexByName("player_hotkey_screen_map");
+  auto fn = player_hotkey_screen_map;
   if(fn==size_t(-1))
     return -1;
 
@@ -1072,7 +1112,7 @@ uint32_t GameScript::messageTime(const Daedalus::ZString& id) const {
   }
 
 int GameScript::printNothingToGet() {
-  auto id = vm.getDATFile().getSymbolIndexByName("player_plunder_is_empty");
+  auto id = player_plunder_is_empty;
   if(id==size_t(-1))
     return 0;
   ScopeVar self(vm, vm.globalSelf(), owner.player());
@@ -1080,13 +1120,13 @@ int GameScript::printNothingToGet() {
   }
 
 void GameScript::useInteractive(Daedalus::GEngineClasses::C_Npc* hnpc,const std::string& func) {
-  auto& dat = vm.getDATFile();
-  if(!dat.hasSymbolName(func.c_str()))
+  auto id = getSymbolIndex(func);
+  if(id==size_t(-1))
     return;
 
   ScopeVar self(vm,vm.globalSelf(),hnpc,Daedalus::IC_Npc);
   try {
-    runFunction(func.c_str());
+    runFunction(id);
     }
   catch (...) {
     Log::i("unable to use interactive [",func,"]");
@@ -1116,19 +1156,21 @@ Attitude GameScript::personAttitude(const Npc &p0, const Npc &p1) const {
   }
 
 BodyState GameScript::schemeToBodystate(const char* sc) {
-  if(searchScheme(sc,"MOB_SIT"))
+  if(searchScheme(sc,MOB_SIT))
     return BS_SIT;
-  if(searchScheme(sc,"MOB_LIE"))
+  if(searchScheme(sc,MOB_LIE))
     return BS_LIE;
-  if(searchScheme(sc,"MOB_CLIMB"))
+  if(searchScheme(sc,MOB_CLIMB))
     return BS_CLIMB;
-  if(searchScheme(sc,"MOB_NOTINTERRUPTABLE"))
+  if(searchScheme(sc,MOB_NOTINTERRUPTABLE))
     return BS_MOBINTERACT;
   return BS_MOBINTERACT_INTERRUPT;
   }
 
-bool GameScript::searchScheme(const char* sc, const char* listName) {
-  auto& list = vm.getDATFile().getSymbolByName(listName).getString();
+bool GameScript::searchScheme(const char* sc, size_t listId) {
+  if(listId==size_t(-1))
+    return false;
+  auto& list = vm.getDATFile().getSymbolByIndex(listId).getString();
   const char* l = list.c_str();
   for(const char* e = l;;++e) {
     if(*e=='\0' || *e==',') {
@@ -1158,6 +1200,7 @@ int32_t GameScript::runFunction(const size_t fid) {
   auto&       sym  = dat.getSymbolByIndex(fid);
   const char* call = sym.name.c_str();(void)call; //for debuging
 
+  ScriptProfiler::Scope scope(profiler.get(),fid);
   int32_t ret = vm.runFunctionBySymIndex(fid);
   return ret;
   }
@@ -1265,10 +1308,9 @@ AiOuputPipe *GameScript::openDlgOuput(Npc &player, Npc &npc) {
   }
 
 int GameScript::npcDamDiveTime() {
-  size_t id = vm.getDATFile().getSymbolIndexByName("NPC_DAM_DIVE_TIME");
-  if(id==size_t(-1))
+  if(NPC_DAM_DIVE_TIME==size_t(-1))
     return 0;
-  auto& var = vm.getDATFile().getSymbolByIndex(id);
+  auto& var = vm.getDATFile().getSymbolByIndex(NPC_DAM_DIVE_TIME);
   return var.getInt(0);
   }
 
@@ -2210,8 +2252,15 @@ void GameScript::npc_checkinfo(Daedalus::DaedalusVM &vm) {
   auto& pl   = *(hpl);
   auto& npc  = *(n->handle());
 
-  for(auto& info:dialogsInfo) {
-    if(info.npc!=int32_t(npc.instanceSymbol) || info.important!=imp)
+  auto hDialog = dialogsByNpc.find(int32_t(npc.instanceSymbol));
+  if(hDialog==dialogsByNpc.end()) {
+    vm.setReturn(0);
+    return;
+    }
+
+  for(auto id:hDialog->second) {
+    auto& info = dialogsInfo[id];
+    if(info.important!=imp)
       continue;
     bool npcKnowsInfo = doesNpcKnowInfo(pl,info.instanceSymbol);
     if(npcKnowsInfo && !info.permanent)
@@ -3010,13 +3059,11 @@ void GameScript::sort(std::vector<GameScript::DlgChoise> &dlg) {
   }
 
 void GameScript::setNpcInfoKnown(const Daedalus::GEngineClasses::C_Npc& npc, const Daedalus::GEngineClasses::C_Info &info) {
-  auto id = std::make_pair(npc.instanceSymbol,info.instanceSymbol);
-  dlgKnownInfos.insert(id);
+  dlgKnownInfos.insert(npc.instanceSymbol,info.instanceSymbol);
   }
 
 bool GameScript::doesNpcKnowInfo(const Daedalus::GEngineClasses::C_Npc& npc, size_t infoInstance) const {
-  auto id = std::make_pair(npc.instanceSymbol,infoInstance);
-  return dlgKnownInfos.find(id)!=dlgKnownInfos.end();
+  return dlgKnownInfos.contains(npc.instanceSymbol,infoInstance);
   }
 
 
@@ -17,7 +17,9 @@
 #include "game/aiouputpipe.h"
 #include "game/constants.h"
 #include "game/aistate.h"
+#include "game/knowninfos.h"
 #include "game/questlog.h"
+#include "game/scriptprofiler.h"
 #include "ui/documentmenu.h"
 
 class Gothic;
@@ -91,6 +93,9 @@ class GameScript final {
     AiOuputPipe* openDlgOuput(Npc &player, Npc &npc);
 
     size_t       goldId() const { return itMi_Gold; }
+    size_t       lockPickId() const { return ItKE_lockpick; }
+    size_t       deadState() const { return ZS_Dead; }
+    size_t       unconsciousState() const { return ZS_Unconscious; }
     const char*  currencyName() const { return goldTxt.c_str(); }
     int          npcDamDiveTime();
     bool         isRamboMode() const;
@@ -186,6 +191,8 @@ class GameScript final {
     template<void(GameScript::*)(Daedalus::DaedalusVM &vm)>
     void  notImplementedFn(const char* name);
 
+    void  bindExternal(const char* name, std::function<void(Daedalus::DaedalusVM&)> fn);
+
     Item* getItem(Daedalus::GEngineClasses::C_Item* handle);
     Item* getItemById(size_t id);
     Npc*  getNpc(Daedalus::GEngineClasses::C_Npc*   handle);
@@ -198,7 +205,7 @@ class GameScript final {
     bool  aiOutput   (Npc &from, const Daedalus::ZString& name);
     bool  aiOutputSvm(Npc &from, const Daedalus::ZString& name, int32_t voice, bool overlay);
 
-    bool  searchScheme(const char* sc,const char* listName);
+    bool  searchScheme(const char* sc,size_t listId);
 
     void game_initgerman     (Daedalus::DaedalusVM& vm);
     void game_initenglish    (Daedalus::DaedalusVM& vm);
@@ -399,11 +406,13 @@ class GameScript final {
     std::unique_ptr<SvmDefinitions>                             svm;
     uint64_t                                                    svmBarrier=0;
 
-    std::set<std::pair<size_t,size_t>>                          dlgKnownInfos;
+    KnownInfos                                                  dlgKnownInfos;
     std::vector<Daedalus::GEngineClasses::C_Info>               dialogsInfo;
+    std::unordered_map<int32_t,std::vector<size_t>>             dialogsByNpc;
     std::unique_ptr<ZenLoad::zCCSLib>                           dialogs;
     std::unordered_map<size_t,AiState>                          aiStates;
     std::unique_ptr<AiOuputPipe>                                aiDefaultPipe;
+    std::unique_ptr<ScriptProfiler>                             profiler;
 
     QuestLog                                                    quests;
     size_t                                                      itMi_Gold=0;
@@ -422,6 +431,27 @@ class GameScript final {
     size_t                                                      ZS_Attack=0;
     size_t                                                      ZS_MM_Attack=0;
 
+    size_t                                                      G_CanNotUse=size_t(-1);
+    size_t                                                      G_CanNotCast=size_t(-1);
+    size_t                                                      G_PickLock=size_t(-1);
+    size_t                                                      C_CanNpcCollideWithSpell=size_t(-1);
+    size_t                                                      Spell_ProcessMana=size_t(-1);
+    size_t                                                      player_hotkey_screen_map=size_t(-1);
+    size_t                                                      player_trade_not_enough_gold=size_t(-1);
+    size_t                                                      player_plunder_is_empty=size_t(-1);
+    size_t                                                      player_mob_missing_item=size_t(-1);
+    size_t                                                      player_mob_missing_key=size_t(-1);
+    size_t                                                      player_mob_missing_lockpick=size_t(-1);
+    size_t                                                      player_mob_missing_key_or_lockpick=size_t(-1);
+    size_t                                                      player_mob_another_is_using=size_t(-1);
+    size_t                                                      NPC_DAM_DIVE_TIME=size_t(-1);
+    size_t                                                      ItKE_lockpick=size_t(-1);
+    size_t                                                      MOB_SIT=size_t(-1);
+    size_t                                                      MOB_LIE=size_t(-1);
+    size_t                                                      MOB_CLIMB=size_t(-1);
+    size_t                                                      MOB_NOTINTERRUPTABLE=size_t(-1);
+    std::vector<size_t>                                         spellCastFn;
+
     Daedalus::GEngineClasses::C_Focus                           cFocusNorm,cFocusMele,cFocusRange,cFocusMage;
     Daedalus::GEngineClasses::C_GilValues                       cGuildVal;
   };
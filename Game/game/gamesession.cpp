@@ -5,6 +5,7 @@
 #include <Tempest/MemReader>
 #include <Tempest/MemWriter>
 #include <cctype>
+#include <algorithm>
 
 #include "worldstatestorage.h"
 #include "serialize.h"
@@ -175,6 +176,10 @@ bool GameSession::isRamboMode() const {
   return gothic.isRamboMode();
   }
 
+bool GameSession::isProfileMode() const {
+  return gothic.isProfileMode();
+  }
+
 const VersionInfo& GameSession::version() const {
   return gothic.version();
   }
@@ -250,6 +255,7 @@ void GameSession::setTime(gtime t) {
 
 void GameSession::tick(uint64_t dt) {
   ticks+=dt;
+  lastStep=dt;
 
   uint64_t add = (dt+wrldTimePart)*multTime;
   wrldTimePart=add%divTime;
@@ -361,7 +367,14 @@ const WorldStateStorage& GameSession::findStorage(const std::string &name) {
   return wss;
   }
 
-void GameSession::updateAnimation() {
+uint64_t GameSession::renderTickCount() const {
+  // rendered state lags behind simulation by (1-alpha) of a step
+  uint64_t lag = uint64_t(float(lastStep)*(1.f-renderAlpha));
+  return ticks>lag ? ticks-lag : 0;
+  }
+
+void GameSession::updateAnimation(float alpha) {
+  renderAlpha = std::min(std::max(alpha,0.f),1.f);
   if(wrld)
     wrld->updateAnimation();
   }
@@ -42,6 +42,7 @@ class GameSession final {
     void         exitSession();
 
     bool         isRamboMode() const;
+    bool         isProfileMode() const;
     auto         version() const -> const VersionInfo&;
 
     const World* world() const { return wrld.get(); }
@@ -70,8 +71,10 @@ class GameSession final {
     void         setTime(gtime t);
     void         tick(uint64_t dt);
     uint64_t     tickCount() const { return ticks; }
+    uint64_t     renderTickCount() const;
+    float        interpolation() const { return renderAlpha; }
 
-    void         updateAnimation();
+    void         updateAnimation(float alpha);
 
     auto         updateDialog(const GameScript::DlgChoise &dlg, Npc &player, Npc &npc) -> std::vector<GameScript::DlgChoise>;
     void         dialogExec(const GameScript::DlgChoise &dlg, Npc &player, Npc &npc);
@@ -111,6 +114,8 @@ class GameSession final {
     std::unique_ptr<World>         wrld;
 
     uint64_t                       ticks=0, wrldTimePart=0;
+    uint64_t                       lastStep=0;
+    float                          renderAlpha=1.f;
     gtime                          wrldTime;
 
     std::vector<WorldStateStorage> visitedWorlds;
@@ -23,6 +23,7 @@ void Inventory::implLoad(Npc* owner, World& world, Serialize &s) {
   s.read(sz);
   for(size_t i=0;i<sz;++i)
     items.emplace_back(std::make_unique<Item>(world,s,false));
+  rebuildIndex();
 
   s.read(sz);
   mdlSlots.resize(sz);
@@ -132,16 +133,14 @@ void Inventory::save(Serialize &fout) const {
   }
 
 int32_t Inventory::priceOf(size_t cls) const {
-  for(auto& i:items)
-    if(i->clsId()==cls)
-      return i->cost();
+  if(auto i = findByClass(cls))
+    return i->cost();
   return 0;
   }
 
 int32_t Inventory::sellPriceOf(size_t cls) const {
-  for(auto& i:items)
-    if(i->clsId()==cls)
-      return i->sellCost();
+  if(auto i = findByClass(cls))
+    return i->sellCost();
   return 0;
   }
 
@@ -153,9 +152,8 @@ size_t Inventory::goldCount() const {
   }
 
 size_t Inventory::itemCount(const size_t cls) const {
-  for(auto& i:items)
-    if(i->clsId()==cls)
-      return i->count();
+  if(auto i = findByClass(cls))
+    return i->count();
   return 0;
   }
 
@@ -221,6 +219,7 @@ Item* Inventory::addItem(std::unique_ptr<Item> &&p) {
   if(it==nullptr) {
     p->clearView();
     items.emplace_back(std::move(p));
+    byClass[cls] = items.back().get();
     return items.back().get();
     } else {
     auto& c = *p->handle();
@@ -250,6 +249,7 @@ Item* Inventory::addItem(size_t itemSymbol, uint32_t count, World &owner) {
       ptr->clearView();
       ptr->setCount(count);
       items.emplace_back(std::move(ptr));
+      byClass[itemSymbol] = items.back().get();
       return items.back().get();
       }
     catch(const Daedalus::InvalidCall& call) {
@@ -297,8 +297,12 @@ void Inventory::delItem(Item *it, uint32_t count, Npc& owner) {
       }
   sorted=false;
 
+  // itData is owned by item: drop index entry before item is destroyed
+  const size_t cls = it->clsId();
+  if(findByClass(cls)==it)
+    byClass.erase(cls);
   for(size_t i=0;i<items.size();++i)
-    if(items[i]->clsId()==itData.instanceSymbol){
+    if(items[i].get()==it){
       items.erase(items.begin()+int(i));
       break;
       }
@@ -326,6 +330,8 @@ void Inventory::trasfer(Inventory &to, Inventory &from, Npc* fromNpc, size_t ite
           }
         from.unequip(&it,*fromNpc);
         }
+      if(from.findByClass(itemSymbol)==&it)
+        from.byClass.erase(itemSymbol);
       to.addItem(std::move(from.items[i]));
       from.items.erase(from.items.begin()+int(i));
       } else {
@@ -500,6 +506,7 @@ void Inventory::clear(GameScript&, Npc&) {
       used.emplace_back(std::move(i));
       }
   items = std::move(used); // Gothic don't clear items, which are in use
+  rebuildIndex();
   }
 
 bool Inventory::hasMissionItems() const {
@@ -823,11 +830,18 @@ void Inventory::equipBestArmour(Npc &owner) {
   setSlot(armour,a,owner,false);
   }
 
-Item *Inventory::findByClass(size_t cls) {
+Item *Inventory::findByClass(size_t cls) const {
+  auto i = byClass.find(cls);
+  if(i==byClass.end())
+    return nullptr;
+  return i->second;
+  }
+
+void Inventory::rebuildIndex() {
+  byClass.clear();
+  byClass.reserve(items.size());
   for(auto& i:items)
-    if(i->clsId()==cls)
-      return i.get();
-  return nullptr;
+    byClass.emplace(i->clsId(),i.get()); // first record wins, as in linear search
   }
 
 Item* Inventory::bestItem(Npc &owner, Inventory::Flags f) {
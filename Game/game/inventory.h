@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <memory>
+#include <unordered_map>
 #include <daedalus/DaedalusGameState.h>
 
 #include "game/constants.h"
@@ -129,7 +130,8 @@ class Inventory final {
     bool   equipNumSlot(Item *next, Npc &owner, bool force);
     void   applyArmour (Item& it, Npc &owner, int32_t sgn);
 
-    Item*  findByClass(size_t cls);
+    Item*  findByClass(size_t cls) const;
+    void   rebuildIndex();
     void   delItem    (Item* it, uint32_t count, Npc& owner);
     void   invalidateCond(Item*& slot,  Npc &owner);
 
@@ -148,6 +150,7 @@ class Inventory final {
 
     mutable std::vector<std::unique_ptr<Item>> items;
     mutable bool                               sorted=false;
+    std::unordered_map<size_t,Item*>           byClass; // item instance -> record; order independent
 
     uint32_t                           indexOf(const Item* it) const;
     Item*                              readPtr(Serialize& fin);
@@ -0,0 +1,81 @@
+#include "knowninfos.h"
+#include "serialize.h"
+
+#include <algorithm>
+
+static const uint64_t emptySlot = uint64_t(-1);
+
+size_t KnownInfos::hash(uint64_t k) {
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdull;
+  k ^= k >> 33;
+  return size_t(k);
+  }
+
+void KnownInfos::insert(size_t npc, size_t info) {
+  insert(key(npc,info));
+  }
+
+bool KnownInfos::contains(size_t npc, size_t info) const {
+  if(count==0)
+    return false;
+  const uint64_t k    = key(npc,info);
+  const size_t   mask = slot.size()-1;
+  for(size_t i=hash(k)&mask; ; i=(i+1)&mask) {
+    if(slot[i]==k)
+      return true;
+    if(slot[i]==emptySlot)
+      return false;
+    }
+  }
+
+void KnownInfos::insert(uint64_t k) {
+  if((count+1)*2>slot.size())
+    rehash(std::max<size_t>(slot.size()*2,64));
+  const size_t mask = slot.size()-1;
+  for(size_t i=hash(k)&mask; ; i=(i+1)&mask) {
+    if(slot[i]==k)
+      return;
+    if(slot[i]==emptySlot) {
+      slot[i] = k;
+      ++count;
+      return;
+      }
+    }
+  }
+
+void KnownInfos::rehash(size_t cap) {
+  std::vector<uint64_t> prev(cap,emptySlot);
+  std::swap(prev,slot);
+  count = 0;
+  for(auto k:prev)
+    if(k!=emptySlot)
+      insert(k);
+  }
+
+void KnownInfos::save(Serialize& fout) const {
+  // same layout as former std::set<pair>: sorted (npc,info) pairs
+  std::vector<uint64_t> keys;
+  keys.reserve(count);
+  for(auto k:slot)
+    if(k!=emptySlot)
+      keys.push_back(k);
+  std::sort(keys.begin(),keys.end());
+
+  fout.write(uint32_t(keys.size()));
+  for(auto k:keys)
+    fout.write(uint32_t(k>>32),uint32_t(k));
+  }
+
+void KnownInfos::load(Serialize& fin) {
+  slot.clear();
+  count = 0;
+
+  uint32_t sz=0;
+  fin.read(sz);
+  for(size_t i=0;i<sz;++i){
+    uint32_t f=0,s=0;
+    fin.read(f,s);
+    insert(f,s);
+    }
+  }
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class Serialize;
+
+class KnownInfos final {
+  public:
+    KnownInfos()=default;
+
+    void   insert  (size_t npc, size_t info);
+    bool   contains(size_t npc, size_t info) const;
+    size_t size() const { return count; }
+
+    void   save(Serialize& fout) const;
+    void   load(Serialize& fin);
+
+  private:
+    // open addressing, linear probing; key is (npc<<32 | info)
+    static uint64_t key(size_t npc, size_t info) { return (uint64_t(npc)<<32) | uint32_t(info); }
+    static size_t   hash(uint64_t k);
+
+    void   insert(uint64_t k);
+    void   rehash(size_t cap);
+
+    std::vector<uint64_t> slot;
+    size_t                count = 0;
+  };
@@ -0,0 +1,57 @@
+#include "scriptprofiler.h"
+
+#include <algorithm>
+#include <iomanip>
+
+void ScriptProfiler::enter(size_t fn) {
+  if(fn>=stat.size())
+    stat.resize(fn+1);
+  stat[fn].calls++;
+  stat[fn].active++;
+
+  Frame f;
+  f.fn    = fn;
+  f.start = clock::now();
+  stack.push_back(f);
+  }
+
+void ScriptProfiler::leave() {
+  if(stack.size()==0)
+    return;
+  auto f  = stack.back();
+  auto dt = clock::now()-f.start;
+  stack.pop_back();
+
+  auto& s = stat[f.fn];
+  s.excl += dt-f.child;
+  s.active--;
+  if(s.active==0)
+    s.incl += dt; // recursive calls are accounted once
+  if(stack.size()>0)
+    stack.back().child += dt;
+  }
+
+void ScriptProfiler::report(std::ostream& out, const std::function<const char*(size_t)>& name) const {
+  using namespace std::chrono;
+
+  std::vector<size_t> order;
+  for(size_t i=0; i<stat.size(); ++i)
+    if(stat[i].calls>0)
+      order.push_back(i);
+  std::sort(order.begin(),order.end(),[this](size_t a, size_t b){
+    return stat[a].excl>stat[b].excl;
+    });
+
+  out << std::setw(10) << "calls"    << std::setw(14) << "incl, ms" << std::setw(14) << "excl, ms"
+      << std::setw(12) << "avg, us"  << "  function" << std::endl;
+  for(auto i:order) {
+    auto& s    = stat[i];
+    auto  incl = duration_cast<microseconds>(s.incl).count();
+    auto  excl = duration_cast<microseconds>(s.excl).count();
+    out << std::setw(10) << s.calls
+        << std::setw(14) << double(incl)/1000.0
+        << std::setw(14) << double(excl)/1000.0
+        << std::setw(12) << double(incl)/double(s.calls)
+        << "  " << name(i) << std::endl;
+    }
+  }
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <ostream>
+#include <vector>
+#include <cstdint>
+
+class ScriptProfiler final {
+  public:
+    ScriptProfiler()=default;
+
+    struct Scope final {
+      Scope(ScriptProfiler* p, size_t fn):owner(p) { if(owner) owner->enter(fn); }
+      Scope(const Scope&)=delete;
+      ~Scope() { if(owner) owner->leave(); }
+
+      ScriptProfiler* owner;
+      };
+
+    void enter(size_t fn);
+    void leave();
+    void report(std::ostream& out, const std::function<const char*(size_t)>& name) const;
+
+  private:
+    using clock = std::chrono::steady_clock;
+
+    struct Stat final {
+      uint64_t        calls  = 0;
+      uint32_t        active = 0;
+      clock::duration incl   = {};
+      clock::duration excl   = {};
+      };
+
+    struct Frame final {
+      size_t            fn = 0;
+      clock::time_point start;
+      clock::duration   child = {};
+      };
+
+    std::vector<Stat>  stat;
+    std::vector<Frame> stack;
+  };
@@ -59,6 +59,9 @@ Gothic::Gothic(const int argc, const char **argv) {
     else if(std::strcmp(argv[i],"-rambo")==0){
       isRambo=true;
       }
+    else if(std::strcmp(argv[i],"-profile")==0){
+      isProfile=true;
+      }
     else if(std::strcmp(argv[i],"-dx12")==0){
       graphics = GraphicBackend::DirectX12;
       }
@@ -408,9 +411,9 @@ void Gothic::tick(uint64_t dt) {
     game->tick(dt);
   }
 
-void Gothic::updateAnimation() {
+void Gothic::updateAnimation(float alpha) {
   if(game)
-    game->updateAnimation();
+    game->updateAnimation(alpha);
   }
 
 void Gothic::quickSave() {
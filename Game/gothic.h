@@ -82,6 +82,7 @@ class Gothic final {
 
     bool      isDebugMode() const;
     bool      isRamboMode() const;
+    bool      isProfileMode() const { return isProfile; }
     bool      isWindowMode() const { return isWindow; }
 
     LoadState checkLoading() const;
@@ -92,7 +93,7 @@ class Gothic final {
 
     void      tick(uint64_t dt);
 
-    void      updateAnimation();
+    void      updateAnimation(float alpha);
     void      quickSave();
     void      quickLoad();
     void      save(const std::string& slot);
@@ -160,6 +161,7 @@ class Gothic final {
     uint16_t                                pauseSum=0;
     bool                                    isDebug=false;
     bool                                    isRambo=false;
+    bool                                    isProfile=false;
     VersionInfo                             vinfo;
     std::mt19937                            randGen;
 
@@ -30,6 +30,7 @@ void AnimationSolver::load(Serialize &fin) {
     fin.read(s,i.time);
     i.skeleton = Resources::loadSkeleton(s.c_str());
     }
+  frmCache.clear();
 
   sz=0;
   for(size_t i=0;i<overlay.size();++i){
@@ -42,6 +43,7 @@ void AnimationSolver::load(Serialize &fin) {
 
 void AnimationSolver::setSkeleton(const Skeleton *sk) {
   baseSk = sk;
+  frmCache.clear();
   }
 
 bool AnimationSolver::hasOverlay(const Skeleton* sk) const {
@@ -58,6 +60,7 @@ void AnimationSolver::addOverlay(const Skeleton* sk,uint64_t time) {
   ov.skeleton = sk;
   ov.time     = time;
   overlay.push_back(ov);
+  frmCache.clear();
   }
 
 void AnimationSolver::delOverlay(const char *sk) {
@@ -71,6 +74,7 @@ void AnimationSolver::delOverlay(const Skeleton *sk) {
   for(size_t i=0;i<overlay.size();++i)
     if(overlay[i].skeleton==sk){
       overlay.erase(overlay.begin()+int(i));
+      frmCache.clear();
       return;
       }
   }
@@ -78,9 +82,12 @@ void AnimationSolver::delOverlay(const Skeleton *sk) {
 void AnimationSolver::update(uint64_t tickCount) {
   for(size_t i=0;i<overlay.size();){
     auto& ov = overlay[i];
-    if(ov.time!=0 && ov.time<tickCount)
-      overlay.erase(overlay.begin()+int(i)); else
+    if(ov.time!=0 && ov.time<tickCount) {
+      overlay.erase(overlay.begin()+int(i));
+      frmCache.clear();
+      } else {
       ++i;
+      }
     }
   }
 
@@ -89,217 +96,217 @@ const Animation::Sequence* AnimationSolver::solveAnim(AnimationSolver::Anim a, W
   if(st==WeaponState::Fist) {
     if(a==Anim::Atack) {
       if(pose.isInAnim("S_FISTRUNL"))
-        return solveFrm("T_FISTATTACKMOVE");
-      return solveFrm("S_FISTATTACK");
+        return solveFrm(Frm::T_FISTATTACKMOVE);
+      return solveFrm(Frm::S_FISTATTACK);
       }
     if(a==Anim::AtackBlock)
-      return solveFrm("T_FISTPARADE_0");
+      return solveFrm(Frm::T_FISTPARADE_0);
     }
   else if(st==WeaponState::W1H || st==WeaponState::W2H) {
     if(a==Anim::Atack && (pose.isInAnim("S_1HRUNL") || pose.isInAnim("S_2HRUNL")))
-      return solveFrm("T_%sATTACKMOVE",st);
+      return solveFrm(Frm::T_xATTACKMOVE,st);
     if(a==Anim::AtackL)
-      return solveFrm("T_%sATTACKL",st);
+      return solveFrm(Frm::T_xATTACKL,st);
     if(a==Anim::AtackR)
-      return solveFrm("T_%sATTACKR",st);
+      return solveFrm(Frm::T_xATTACKR,st);
     if(a==Anim::Atack || a==Anim::AtackL || a==Anim::AtackR)
-      return solveFrm("S_%sATTACK",st); // TODO: proper atack  window
+      return solveFrm(Frm::S_xATTACK,st); // TODO: proper atack  window
     if(a==Anim::AtackBlock) {
       const Animation::Sequence* s=nullptr;
       switch(std::rand()%3){
-        case 0: s = solveFrm("T_%sPARADE_0",   st); break;
-        case 1: s = solveFrm("T_%sPARADE_0_A2",st); break;
-        case 2: s = solveFrm("T_%sPARADE_0_A3",st); break;
+        case 0: s = solveFrm(Frm::T_xPARADE_0,st); break;
+        case 1: s = solveFrm(Frm::T_xPARADE_0_A2,st); break;
+        case 2: s = solveFrm(Frm::T_xPARADE_0_A3,st); break;
         }
       if(s==nullptr)
-        s = solveFrm("T_%sPARADE_0",st);
+        s = solveFrm(Frm::T_xPARADE_0,st);
       return s;
       }
     if(a==Anim::AtackFinish)
-      return solveFrm("T_%sSFINISH",st);
+      return solveFrm(Frm::T_xSFINISH,st);
     }
   else if(st==WeaponState::Bow || st==WeaponState::CBow) {
     // S_BOWAIM -> S_BOWSHOOT+T_BOWRELOAD -> S_BOWAIM
     if(a==Anim::AimBow) {
       if(pose.isInAnim("S_BOWRUN")  || pose.isInAnim("S_CBOWRUN") ||
          pose.isInAnim("S_BOWWALK") || pose.isInAnim("S_CBOWWALK"))
-        return solveFrm("T_%sRUN_2_%sAIM",st);
+        return solveFrm(Frm::T_xRUN_2_xAIM,st);
       if(pose.isInAnim("S_BOWSHOOT") || pose.isInAnim("S_CBOWSHOOT"))
-        return solveFrm("T_%sRELOAD",st);
+        return solveFrm(Frm::T_xRELOAD,st);
       if(!pose.hasAnim() || pose.isInAnim("T_BOWRUN_2_BOWAIM") || pose.isInAnim("T_CBOWRUN_2_CBOWAIM"))
-        return solveFrm("S_%sSHOOT",st);
+        return solveFrm(Frm::S_xSHOOT,st);
       }
     if(a==Anim::Atack) {
       if(pose.isInAnim("S_BOWAIM") || pose.isInAnim("S_CBOWAIM"))
-        return solveFrm("S_%sSHOOT",st);
+        return solveFrm(Frm::S_xSHOOT,st);
       }
     if(a==Anim::Idle) {
       if(!pose.hasAnim())
-        return solveFrm("S_%sRUN",st);
+        return solveFrm(Frm::S_xRUN,st);
       if(pose.isInAnim("S_BOWSHOOT") || pose.isInAnim("S_CBOWSHOOT"))
-        return solveFrm("T_%sAIM_2_%sRUN",st);
+        return solveFrm(Frm::T_xAIM_2_xRUN,st);
       }
     }
   if(a==Anim::MagNoMana)
-    return solveFrm("T_CASTFAIL");
+    return solveFrm(Frm::T_CASTFAIL);
   // Move
   if(a==Idle) {
     if(bool(wlkMode & WalkBit::WM_Dive))
-      return solveFrm("S_DIVE");
+      return solveFrm(Frm::S_DIVE);
     if(bool(wlkMode & WalkBit::WM_Swim))
-      return solveFrm("S_SWIM");
+      return solveFrm(Frm::S_SWIM);
     if(bool(wlkMode&WalkBit::WM_Sneak))
-      return solveFrm("S_%sSNEAK",st);
+      return solveFrm(Frm::S_xSNEAK,st);
     if(bool(wlkMode&WalkBit::WM_Walk))
-      return solveFrm("S_%sWALK",st);
-    return solveFrm("S_%sRUN",st);
+      return solveFrm(Frm::S_xWALK,st);
+    return solveFrm(Frm::S_xRUN,st);
     }
   if(a==Move)  {
     if(bool(wlkMode & WalkBit::WM_Dive)) {
       if(pose.bodyState()==BS_DIVE)
-        return solveFrm("S_DIVEF",st); else
-        return solveFrm("S_DIVE");
+        return solveFrm(Frm::S_DIVEF,st); else
+        return solveFrm(Frm::S_DIVE);
       }
     if(bool(wlkMode & WalkBit::WM_Swim))
-      return solveFrm("S_SWIMF",st);
+      return solveFrm(Frm::S_SWIMF,st);
     if(bool(wlkMode & WalkBit::WM_Sneak))
-      return solveFrm("S_%sSNEAKL",st);
+      return solveFrm(Frm::S_xSNEAKL,st);
     if(bool(wlkMode & WalkBit::WM_Walk))
-      return solveFrm("S_%sWALKL",st);
+      return solveFrm(Frm::S_xWALKL,st);
     if(bool(wlkMode & WalkBit::WM_Water))
-      return solveFrm("S_%sWALKWL",st);
-    return solveFrm("S_%sRUNL",st);
+      return solveFrm(Frm::S_xWALKWL,st);
+    return solveFrm(Frm::S_xRUNL,st);
     }
   if(a==MoveL) {
     if(bool(wlkMode & WalkBit::WM_Dive))
-      return solveFrm("S_DIVE"); // ???
+      return solveFrm(Frm::S_DIVE); // ???
     if(bool(wlkMode & WalkBit::WM_Swim))
-      return solveFrm("S_SWIM"); // ???
+      return solveFrm(Frm::S_SWIM); // ???
     if(bool(wlkMode & WalkBit::WM_Sneak))
-      return solveFrm("T_%sSNEAKSTRAFEL",st);
+      return solveFrm(Frm::T_xSNEAKSTRAFEL,st);
     if(bool(wlkMode & WalkBit::WM_Walk))
-      return solveFrm("T_%sWALKWSTRAFEL",st);
+      return solveFrm(Frm::T_xWALKWSTRAFEL,st);
     if(bool(wlkMode & WalkBit::WM_Water))
-      return solveFrm("T_%sWALKWSTRAFEL",st);
-    return solveFrm("T_%sRUNSTRAFEL",st);
+      return solveFrm(Frm::T_xWALKWSTRAFEL,st);
+    return solveFrm(Frm::T_xRUNSTRAFEL,st);
     }
   if(a==MoveR) {
     if(bool(wlkMode & WalkBit::WM_Dive))
-      return solveFrm("S_DIVE"); // ???
+      return solveFrm(Frm::S_DIVE); // ???
     if(bool(wlkMode & WalkBit::WM_Swim))
-      return solveFrm("S_SWIM"); // ???
+      return solveFrm(Frm::S_SWIM); // ???
     if(bool(wlkMode & WalkBit::WM_Sneak))
-      return solveFrm("T_%sSNEAKSTRAFER",st);
+      return solveFrm(Frm::T_xSNEAKSTRAFER,st);
     if(bool(wlkMode & WalkBit::WM_Walk))
-      return solveFrm("T_%sWALKWSTRAFER",st);
+      return solveFrm(Frm::T_xWALKWSTRAFER,st);
     if(bool(wlkMode & WalkBit::WM_Water))
-      return solveFrm("T_%sWALKWSTRAFER",st);
-    return solveFrm("T_%sRUNSTRAFER",st);
+      return solveFrm(Frm::T_xWALKWSTRAFER,st);
+    return solveFrm(Frm::T_xRUNSTRAFER,st);
     }
   if(a==Anim::MoveBack) {
     if(bool(wlkMode & WalkBit::WM_Dive))
-      return solveFrm("S_DIVE");
+      return solveFrm(Frm::S_DIVE);
     if(bool(wlkMode & WalkBit::WM_Swim))
-      return solveFrm("S_SWIMB");
+      return solveFrm(Frm::S_SWIMB);
     if(bool(wlkMode & WalkBit::WM_Sneak))
-      return solveFrm("S_%sSNEAKBL",st);
+      return solveFrm(Frm::S_xSNEAKBL,st);
     if(st==WeaponState::Fist)
-      return solveFrm("T_%sPARADEJUMPB",st);
-    return solveFrm("T_%sJUMPB",st);
+      return solveFrm(Frm::T_xPARADEJUMPB,st);
+    return solveFrm(Frm::T_xJUMPB,st);
     }
   // Rotation
   if(a==RotL) {
     if(bool(wlkMode & WalkBit::WM_Dive))
-      return solveFrm("T_DIVETURNL");
+      return solveFrm(Frm::T_DIVETURNL);
     if(bool(wlkMode & WalkBit::WM_Swim))
-      return solveFrm("T_SWIMTURNL");
+      return solveFrm(Frm::T_SWIMTURNL);
     if(bool(wlkMode & WalkBit::WM_Sneak))
-      return solveFrm("T_SNEAKTURNL");
+      return solveFrm(Frm::T_SNEAKTURNL);
     if(bool(wlkMode & WalkBit::WM_Walk))
-      return solveFrm("T_%sWALKTURNL",st);
+      return solveFrm(Frm::T_xWALKTURNL,st);
     if(bool(wlkMode & WalkBit::WM_Water))
-      return solveFrm("T_%sWALKWTURNL",st);
-    return solveFrm("T_%sRUNTURNL",st);
+      return solveFrm(Frm::T_xWALKWTURNL,st);
+    return solveFrm(Frm::T_xRUNTURNL,st);
     }
   if(a==RotR) {
     if(bool(wlkMode & WalkBit::WM_Dive))
-      return solveFrm("T_DIVETURNR");
+      return solveFrm(Frm::T_DIVETURNR);
     if(bool(wlkMode & WalkBit::WM_Swim))
-      return solveFrm("T_SWIMTURNR");
+      return solveFrm(Frm::T_SWIMTURNR);
     if(bool(wlkMode & WalkBit::WM_Sneak))
-      return solveFrm("T_SNEAKTURNR");
+      return solveFrm(Frm::T_SNEAKTURNR);
     if(bool(wlkMode & WalkBit::WM_Walk))
-      return solveFrm("T_%sWALKTURNR",st);
+      return solveFrm(Frm::T_xWALKTURNR,st);
     if(bool(wlkMode & WalkBit::WM_Water))
-      return solveFrm("T_%sWALKWTURNR",st);
-    return solveFrm("T_%sRUNTURNR",st);
+      return solveFrm(Frm::T_xWALKWTURNR,st);
+    return solveFrm(Frm::T_xRUNTURNR,st);
     }
   // Jump regular
   if(a==Jump) {
     if(pose.isIdle())
-      return solveFrm("T_STAND_2_JUMP");
-    return solveFrm("S_JUMP");
+      return solveFrm(Frm::T_STAND_2_JUMP);
+    return solveFrm(Frm::S_JUMP);
     }
   if(a==JumpUpLow) {
     if(pose.isIdle())
-      return solveFrm("T_STAND_2_JUMPUPLOW");
-    return solveFrm("S_JUMPUPLOW");
+      return solveFrm(Frm::T_STAND_2_JUMPUPLOW);
+    return solveFrm(Frm::S_JUMPUPLOW);
     }
   if(a==JumpUpMid) {
     if(pose.isIdle())
-      return solveFrm("T_STAND_2_JUMPUPMID");
-    return solveFrm("S_JUMPUPMID");
+      return solveFrm(Frm::T_STAND_2_JUMPUPMID);
+    return solveFrm(Frm::S_JUMPUPMID);
     }
   if(a==JumpUp) {
     if(pose.isIdle())
-      return solveFrm("T_STAND_2_JUMPUP");
-    return solveFrm("S_JUMPUP");
+      return solveFrm(Frm::T_STAND_2_JUMPUP);
+    return solveFrm(Frm::S_JUMPUP);
     }
   if(a==JumpHang) {
     if(pose.bodyState()==BS_JUMP)  {
-      if(auto ret = solveFrm("T_JUMPUP_2_HANG"))
+      if(auto ret = solveFrm(Frm::T_JUMPUP_2_HANG))
         return ret;
       }
     //return solveFrm("S_HANG");
-    return solveFrm("T_HANG_2_STAND");
+    return solveFrm(Frm::T_HANG_2_STAND);
     }
 
   if(a==Anim::Fallen)
-    return solveFrm("S_FALLEN"); //TODO: S_FALLENB
+    return solveFrm(Frm::S_FALLEN); //TODO: S_FALLENB
   if(a==Anim::Fall)
-    return solveFrm("S_FALLDN");
+    return solveFrm(Frm::S_FALLDN);
   if(a==Anim::FallDeep)
-    return solveFrm("S_FALL");
+    return solveFrm(Frm::S_FALL);
   if(a==Anim::SlideA)
-    return solveFrm("S_SLIDE");
+    return solveFrm(Frm::S_SLIDE);
   if(a==Anim::SlideB)
-    return solveFrm("S_SLIDEB");
+    return solveFrm(Frm::S_SLIDEB);
   if(a==Anim::StumbleA)
-    return solveFrm("T_STUMBLE");
+    return solveFrm(Frm::T_STUMBLE);
   if(a==Anim::StumbleB)
-    return solveFrm("T_STUMBLEB");
+    return solveFrm(Frm::T_STUMBLEB);
   if(a==Anim::DeadA) {
     if(pose.isInAnim("S_WOUNDED")  || pose.isInAnim("T_STAND_2_WOUNDED") ||
        pose.isInAnim("S_WOUNDEDB") || pose.isInAnim("T_STAND_2_WOUNDEDB"))
-      return solveDead("T_WOUNDED_2_DEAD","T_WOUNDEDB_2_DEADB");
+      return solveDead(Frm::T_WOUNDED_2_DEAD,Frm::T_WOUNDEDB_2_DEADB);
     if(pose.bodyState()==BS_FALL)
-      return solveDead("T_DEAD", "T_DEADB");
+      return solveDead(Frm::T_DEAD,Frm::T_DEADB);
     if(pose.hasAnim())
-      return solveDead("T_DEAD", "T_DEADB");
-    return solveDead("S_DEAD", "S_DEADB");
+      return solveDead(Frm::T_DEAD,Frm::T_DEADB);
+    return solveDead(Frm::S_DEAD,Frm::S_DEADB);
     }
   if(a==Anim::DeadB) {
     if(pose.isInAnim("S_WOUNDED")  || pose.isInAnim("T_STAND_2_WOUNDED") ||
        pose.isInAnim("S_WOUNDEDB") || pose.isInAnim("T_STAND_2_WOUNDEDB"))
-      return solveDead("T_WOUNDEDB_2_DEADB","T_WOUNDED_2_DEAD");
+      return solveDead(Frm::T_WOUNDEDB_2_DEADB,Frm::T_WOUNDED_2_DEAD);
     if(pose.hasAnim())
-      return solveDead("T_DEADB","T_DEAD"); else
-      return solveDead("S_DEADB","S_DEAD");
+      return solveDead(Frm::T_DEADB,Frm::T_DEAD); else
+      return solveDead(Frm::S_DEADB,Frm::S_DEAD);
     }
   if(a==Anim::UnconsciousA)
-    return solveFrm("T_STAND_2_WOUNDED");
+    return solveFrm(Frm::T_STAND_2_WOUNDED);
   if(a==Anim::UnconsciousB)
-    return solveFrm("T_STAND_2_WOUNDEDB");
+    return solveFrm(Frm::T_STAND_2_WOUNDEDB);
   return nullptr;
   }
 
@@ -310,8 +317,8 @@ const Animation::Sequence *AnimationSolver::solveAnim(WeaponState st, WeaponStat
   switch(st) {
     case WeaponState::NoWeapon:
       if(run)
-        return solveFrm("T_%sMOVE_2_MOVE",cur);
-      return solveFrm("T_%sRUN_2_%s",cur);
+        return solveFrm(Frm::T_xMOVE_2_MOVE,cur);
+      return solveFrm(Frm::T_xRUN_2_x,cur);
     case WeaponState::Fist:
     case WeaponState::Mage:
     case WeaponState::W1H:
@@ -319,8 +326,8 @@ const Animation::Sequence *AnimationSolver::solveAnim(WeaponState st, WeaponStat
     case WeaponState::Bow:
     case WeaponState::CBow:
       if(run)
-        return solveFrm("T_MOVE_2_%sMOVE",st);
-      return solveFrm("T_%s_2_%sRUN",st);
+        return solveFrm(Frm::T_MOVE_2_xMOVE,st);
+      return solveFrm(Frm::T_x_2_xRUN,st);
     }
   return nullptr;
   }
@@ -342,6 +349,100 @@ const Animation::Sequence *AnimationSolver::solveAnim(Interactive *inter, Animat
     }
   }
 
+static const char* frmFormat[] = {
+  "T_FISTATTACKMOVE",
+  "S_FISTATTACK",
+  "T_FISTPARADE_0",
+  "T_%sATTACKMOVE",
+  "T_%sATTACKL",
+  "T_%sATTACKR",
+  "S_%sATTACK",
+  "T_%sPARADE_0",
+  "T_%sPARADE_0_A2",
+  "T_%sPARADE_0_A3",
+  "T_%sSFINISH",
+  "T_%sRUN_2_%sAIM",
+  "T_%sRELOAD",
+  "S_%sSHOOT",
+  "S_%sRUN",
+  "T_%sAIM_2_%sRUN",
+  "T_CASTFAIL",
+  "S_DIVE",
+  "S_SWIM",
+  "S_%sSNEAK",
+  "S_%sWALK",
+  "S_DIVEF",
+  "S_SWIMF",
+  "S_%sSNEAKL",
+  "S_%sWALKL",
+  "S_%sWALKWL",
+  "S_%sRUNL",
+  "T_%sSNEAKSTRAFEL",
+  "T_%sWALKWSTRAFEL",
+  "T_%sRUNSTRAFEL",
+  "T_%sSNEAKSTRAFER",
+  "T_%sWALKWSTRAFER",
+  "T_%sRUNSTRAFER",
+  "S_SWIMB",
+  "S_%sSNEAKBL",
+  "T_%sPARADEJUMPB",
+  "T_%sJUMPB",
+  "T_DIVETURNL",
+  "T_SWIMTURNL",
+  "T_SNEAKTURNL",
+  "T_%sWALKTURNL",
+  "T_%sWALKWTURNL",
+  "T_%sRUNTURNL",
+  "T_DIVETURNR",
+  "T_SWIMTURNR",
+  "T_SNEAKTURNR",
+  "T_%sWALKTURNR",
+  "T_%sWALKWTURNR",
+  "T_%sRUNTURNR",
+  "T_STAND_2_JUMP",
+  "S_JUMP",
+  "T_STAND_2_JUMPUPLOW",
+  "S_JUMPUPLOW",
+  "T_STAND_2_JUMPUPMID",
+  "S_JUMPUPMID",
+  "T_STAND_2_JUMPUP",
+  "S_JUMPUP",
+  "T_JUMPUP_2_HANG",
+  "T_HANG_2_STAND",
+  "S_FALLEN",
+  "S_FALLDN",
+  "S_FALL",
+  "S_SLIDE",
+  "S_SLIDEB",
+  "T_STUMBLE",
+  "T_STUMBLEB",
+  "T_STAND_2_WOUNDED",
+  "T_STAND_2_WOUNDEDB",
+  "T_%sMOVE_2_MOVE",
+  "T_%sRUN_2_%s",
+  "T_MOVE_2_%sMOVE",
+  "T_%s_2_%sRUN",
+  "T_WOUNDED_2_DEAD",
+  "T_WOUNDEDB_2_DEADB",
+  "T_DEAD",
+  "T_DEADB",
+  "S_DEAD",
+  "S_DEADB",
+  };
+
+const Animation::Sequence* AnimationSolver::solveFrm(Frm f, WeaponState st) const {
+  static_assert(sizeof(frmFormat)/sizeof(frmFormat[0])==size_t(Frm::Count),"frmFormat mismatch");
+  // table is filled on demand, and reset when skeleton/overlays change
+  if(frmCache.size()==0)
+    frmCache.resize(size_t(Frm::Count)*WeaponCount);
+  auto& c = frmCache[size_t(f)*WeaponCount+size_t(st)];
+  if(!c.ready) {
+    c.seq   = solveFrm(frmFormat[size_t(f)],st);
+    c.ready = true;
+    }
+  return c.seq;
+  }
+
 const Animation::Sequence *AnimationSolver::solveFrm(const char *format, WeaponState st) const {
   static const char* weapon[] = {
     "",
@@ -407,7 +508,7 @@ const Animation::Sequence* AnimationSolver::solveMag(const char *format, const s
   return solveFrm(name);
   }
 
-const Animation::Sequence *AnimationSolver::solveDead(const char *format1, const char *format2) const {
+const Animation::Sequence *AnimationSolver::solveDead(Frm format1, Frm format2) const {
   if(auto a=solveFrm(format1))
     return a;
   return solveFrm(format2);
@@ -87,11 +87,103 @@ class AnimationSolver final {
     const Animation::Sequence*     solveAnim(Interactive *inter, Anim a, const Pose &pose) const;
 
   private:
+    enum { WeaponCount = int(WeaponState::Mage)+1 };
+
+    // format of animation name; 'x' is placeholder for weapon
+    enum class Frm : uint8_t {
+      T_FISTATTACKMOVE,
+      S_FISTATTACK,
+      T_FISTPARADE_0,
+      T_xATTACKMOVE,
+      T_xATTACKL,
+      T_xATTACKR,
+      S_xATTACK,
+      T_xPARADE_0,
+      T_xPARADE_0_A2,
+      T_xPARADE_0_A3,
+      T_xSFINISH,
+      T_xRUN_2_xAIM,
+      T_xRELOAD,
+      S_xSHOOT,
+      S_xRUN,
+      T_xAIM_2_xRUN,
+      T_CASTFAIL,
+      S_DIVE,
+      S_SWIM,
+      S_xSNEAK,
+      S_xWALK,
+      S_DIVEF,
+      S_SWIMF,
+      S_xSNEAKL,
+      S_xWALKL,
+      S_xWALKWL,
+      S_xRUNL,
+      T_xSNEAKSTRAFEL,
+      T_xWALKWSTRAFEL,
+      T_xRUNSTRAFEL,
+      T_xSNEAKSTRAFER,
+      T_xWALKWSTRAFER,
+      T_xRUNSTRAFER,
+      S_SWIMB,
+      S_xSNEAKBL,
+      T_xPARADEJUMPB,
+      T_xJUMPB,
+      T_DIVETURNL,
+      T_SWIMTURNL,
+      T_SNEAKTURNL,
+      T_xWALKTURNL,
+      T_xWALKWTURNL,
+      T_xRUNTURNL,
+      T_DIVETURNR,
+      T_SWIMTURNR,
+      T_SNEAKTURNR,
+      T_xWALKTURNR,
+      T_xWALKWTURNR,
+      T_xRUNTURNR,
+      T_STAND_2_JUMP,
+      S_JUMP,
+      T_STAND_2_JUMPUPLOW,
+      S_JUMPUPLOW,
+      T_STAND_2_JUMPUPMID,
+      S_JUMPUPMID,
+      T_STAND_2_JUMPUP,
+      S_JUMPUP,
+      T_JUMPUP_2_HANG,
+      T_HANG_2_STAND,
+      S_FALLEN,
+      S_FALLDN,
+      S_FALL,
+      S_SLIDE,
+      S_SLIDEB,
+      T_STUMBLE,
+      T_STUMBLEB,
+      T_STAND_2_WOUNDED,
+      T_STAND_2_WOUNDEDB,
+      T_xMOVE_2_MOVE,
+      T_xRUN_2_x,
+      T_MOVE_2_xMOVE,
+      T_x_2_xRUN,
+      T_WOUNDED_2_DEAD,
+      T_WOUNDEDB_2_DEADB,
+      T_DEAD,
+      T_DEADB,
+      S_DEAD,
+      S_DEADB,
+      Count
+      };
+
+    struct FrmCache final {
+      const Animation::Sequence*   seq   = nullptr;
+      bool                         ready = false;
+      };
+
+    const Animation::Sequence*     solveFrm    (Frm f, WeaponState st = WeaponState::NoWeapon) const;
     const Animation::Sequence*     solveFrm    (const char *format, WeaponState st) const;
 
     const Animation::Sequence*     solveMag    (const char *format, const std::string& spell) const;
-    const Animation::Sequence*     solveDead   (const char *format1, const char *format2) const;
+    const Animation::Sequence*     solveDead   (Frm format1, Frm format2) const;
 
     const Skeleton*                baseSk=nullptr;
     std::vector<Overlay>           overlay;
+    mutable std::vector<FrmCache>  frmCache;
   };
@@ -340,7 +340,7 @@ void MdlVisual::updateWeaponSkeleton(const Item* weapon,const Item* range) {
 
 bool MdlVisual::updateAnimation(Npc* npc, World& world) {
   Pose&    pose      = *skInst;
-  uint64_t tickCount = world.tickCount();
+  uint64_t tickCount = world.renderTickCount();
 
   if(npc!=nullptr && npc->world().isInListenerRange(npc->position()))
     pose.processSfx(*npc,tickCount);
@@ -9,6 +9,7 @@
 #include "animmath.h"
 
 #include <cmath>
+#include <algorithm>
 
 using namespace Tempest;
 
@@ -236,7 +237,7 @@ bool Pose::update(uint64_t tickCount) {
         if(auto sx = i.seq->comb[size_t(i.comb-1)])
           seq = sx;
         }
-      needToUpdate |= updateFrame(*seq,lastUpdate,i.sAnim,tickCount);
+      needToUpdate |= updateFrame(*seq,lastUpdate,i.sAnim,std::max(tickCount,i.sAnim));
       }
     lastUpdate = tickCount;
     }
@@ -380,12 +381,14 @@ void Pose::onRemoveLayer(Pose::Layer &l) {
 
 void Pose::processSfx(Npc &npc, uint64_t tickCount) {
   for(auto& i:lay)
-    i.seq->processSfx(lastUpdate,i.sAnim,tickCount,npc);
+    if(i.sAnim<=tickCount)
+      i.seq->processSfx(lastUpdate,i.sAnim,tickCount,npc);
   }
 
 void Pose::processPfx(MdlVisual& visual, World& world, uint64_t tickCount) {
   for(auto& i:lay)
-    i.seq->processPfx(lastUpdate,i.sAnim,tickCount,visual,world);
+    if(i.sAnim<=tickCount)
+      i.seq->processPfx(lastUpdate,i.sAnim,tickCount,visual,world);
   }
 
 void Pose::processEvents(uint64_t &barrier, uint64_t now, Animation::EvCount &ev) const {
@@ -39,6 +39,10 @@ const Light &WorldView::mainLight() const {
   return sGlobal.sun;
   }
 
+bool WorldView::isInView(const Vec3& pos, float R) const {
+  return frustrum.testPoint(pos.x,pos.y,pos.z,R);
+  }
+
 void WorldView::tick(uint64_t /*dt*/) {
   auto pl = owner.player();
   if(pl!=nullptr) {
@@ -68,7 +72,9 @@ size_t WorldView::addLight(const ZenLoad::zCVobData& vob) {
 
 void WorldView::setModelView(const Matrix4x4& view, const Tempest::Matrix4x4* shadow, size_t shCount) {
   updateLight();
-  sGlobal.setModelView(viewProj(view),shadow,shCount);
+  auto vp = viewProj(view);
+  frustrum.make(vp);
+  sGlobal.setModelView(vp,shadow,shCount);
   }
 
 void WorldView::setFrameGlobals(const Texture2d& shadow, uint64_t tickCount, uint8_t fId) {
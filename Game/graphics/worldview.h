@@ -10,6 +10,7 @@
 #include "graphics/landscape.h"
 #include "graphics/meshobjects.h"
 #include "graphics/pfxobjects.h"
+#include "graphics/dynamic/frustrum.h"
 #include "light.h"
 #include "sceneglobals.h"
 #include "visualobjects.h"
@@ -30,6 +31,7 @@ class WorldView {
     Tempest::Matrix4x4        viewProj(const Tempest::Matrix4x4 &view) const;
     const Tempest::Matrix4x4& projective() const { return proj; }
     const Light&              mainLight() const;
+    bool                      isInView(const Tempest::Vec3& pos, float R) const;
 
     void tick(uint64_t dt);
 
@@ -69,6 +71,7 @@ class WorldView {
     Landscape               land;
 
     Tempest::Matrix4x4      proj;
+    Frustrum                frustrum;
     uint32_t                vpWidth=0;
     uint32_t                vpHeight=0;
 
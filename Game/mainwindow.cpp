@@ -20,6 +20,8 @@
 #include "utils/crashlog.h"
 #include "utils/gthfont.h"
 
+#include <algorithm>
+
 using namespace Tempest;
 
 MainWindow::MainWindow(Gothic &gothic, Device& device)
@@ -35,6 +37,11 @@ MainWindow::MainWindow(Gothic &gothic, Device& device)
   for(uint8_t i=0;i<device.maxFramesInFlight();++i)
     fLocal.emplace_back(device);
 
+  int simRate = gothic.settingsGetI("ENGINE","simulationRate");
+  if(simRate<=0)
+    simRate = 30;
+  simStep = uint64_t(std::max(1000/simRate,1));
+
   renderer.resetSwapchain();
   setupUi();
 
@@ -535,15 +542,21 @@ void MainWindow::tick() {
     dt=50;
   dialogs.tick(dt);
   inventory.tick(dt);
-  gothic.tick(dt);
 
-  if(dialogs.isActive())
-    clearInput();
+  // simulation runs with fixed step; rendering interpolates between last two steps
+  simAccum += dt;
+  while(simAccum>=simStep) {
+    simAccum -= simStep;
+    gothic.tick(simStep);
 
-  player.tickFocus();
-  if(document.isActive())
-    clearInput();
-  player.tickMove(dt);
+    if(dialogs.isActive())
+      clearInput();
+
+    player.tickFocus();
+    if(document.isActive())
+      clearInput();
+    player.tickMove(simStep);
+    }
   }
 
 void MainWindow::isDialogClosed(bool& ret) {
@@ -579,13 +592,13 @@ void MainWindow::followCamera() {
     }
   else if(player.focus().npc!=nullptr && meleeFocus) {
     auto spin = camera.destSpin();
-    spin.x = pl->rotation();
+    spin.x = pl->renderRotation();
     camera.setSpin(spin);
     camera.setDestPosition(pos.x,pos.y,pos.z);
     }
   else {
     auto spin = camera.destSpin();
-    spin.x = pl->rotation();
+    spin.x = pl->renderRotation();
     if(pl->isDive())
       spin.y = -pl->rotationY();
     camera.setDestSpin(spin);
@@ -722,6 +735,7 @@ void MainWindow::onWorldLoaded() {
   if(auto pl = gothic.player())
     pl->multSpeed(1.f);
   lastTick = Application::tickCount();
+  simAccum = 0;
   player.clearFocus();
   }
 
@@ -758,7 +772,7 @@ void MainWindow::render(){
     video.tick();
     if(!video.isActive() && !gothic.isPause()) {
       tick();
-      gothic.updateAnimation();
+      gothic.updateAnimation(float(simAccum)/float(simStep));
       followCamera();
       }
 
@@ -141,6 +141,8 @@ class MainWindow : public Tempest::Window {
     Tempest::Point            mpos;
     PlayerControl             player;
     uint64_t                  lastTick=0;
+    uint64_t                  simStep=0;
+    uint64_t                  simAccum=0;
 
     struct Fps {
       uint64_t dt[10]={};
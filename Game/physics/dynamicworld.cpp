@@ -38,6 +38,7 @@
 #include <cmath>
 
 #include "world/bullet.h"
+#include "utils/workers.h"
 #include "graphics/submesh/packedmesh.h"
 
 const float DynamicWorld::ghostPadding=50-22.5f;
@@ -78,12 +79,16 @@ struct DynamicWorld::Broadphase : btDbvtBroadphase {
 
   Broadphase() {
     m_deferedcollide = true;
-    rayTestStk.reserve(btDbvt::DOUBLE_STACKSIZE);
     m_paircache->setOverlapFilterCallback(&overlapFilter);
     }
 
   void rayTest(const btVector3& rayFrom, const btVector3& rayTo, btBroadphaseRayCallback& rayCallback,
                const btVector3& aabbMin, const btVector3& aabbMax) {
+    // traversal stack is per-thread, so rays can be casted in parallel
+    thread_local btAlignedObjectArray<const btDbvtNode*> rayTestStk;
+    if(rayTestStk.capacity()==0)
+      rayTestStk.reserve(btDbvt::DOUBLE_STACKSIZE);
+
     BroadphaseRayTester callback(rayCallback);
     btAlignedObjectArray<const btDbvtNode*>* stack = &rayTestStk;
 
@@ -110,7 +115,6 @@ struct DynamicWorld::Broadphase : btDbvtBroadphase {
         callback);
     }
 
-  btAlignedObjectArray<const btDbvtNode*> rayTestStk;
   OverlapFilter                           overlapFilter;
   };
 
@@ -378,47 +382,86 @@ struct DynamicWorld::NpcBodyList final {
   float                 maxR=0;
   };
 
+template<class T>
+static void swapRemove(std::vector<T>& v, size_t id) {
+  v[id] = std::move(v.back());
+  v.pop_back();
+  }
+
 struct DynamicWorld::BulletsList final {
   BulletsList(DynamicWorld& wrld):wrld(wrld){
     }
 
-  BulletBody* add(BulletCallback* cb) {
-    BulletBody b(&wrld,cb);
-    body.push_front(std::move(b));
-    return &body.front();
+  uint32_t add(BulletBody* b, BulletCallback* c) {
+    body   .push_back(b);
+    cb     .push_back(c);
+    pos    .emplace_back();
+    lastPos.emplace_back();
+    dir    .emplace_back();
+    dirL   .push_back(0.f);
+    totalL .push_back(0.f);
+    grav   .push_back(float(gravity));
+    spl    .push_back(std::numeric_limits<int>::max());
+    return uint32_t(body.size()-1);
     }
 
-  void del(BulletBody* b) {
-    for(auto i=body.begin(), e=body.end();i!=e;++i){
-      if(&(*i)==b) {
-        body.erase(i);
-        return;
-        }
-      }
+  void del(uint32_t id) {
+    swapRemove(body,   id);
+    swapRemove(cb,     id);
+    swapRemove(pos,    id);
+    swapRemove(lastPos,id);
+    swapRemove(dir,    id);
+    swapRemove(dirL,   id);
+    swapRemove(totalL, id);
+    swapRemove(grav,   id);
+    swapRemove(spl,    id);
+    if(id<body.size())
+      body[id]->id = id;
     }
 
   void tick(uint64_t dt) {
-    for(auto& i:body) {
-      wrld.moveBullet(i,i.dir.x,i.dir.y,i.dir.z,dt);
-      if(i.cb!=nullptr)
-        i.cb->onMove();
+    const float  k = float(dt)/1000.f;
+    const size_t n = body.size();
+
+    // integrate all slots at once; collisions are resolved per bullet below
+    next.resize(n);
+    for(size_t i=0; i<n; ++i) {
+      next[i].x = pos[i].x + dir[i].x*k;
+      next[i].y = pos[i].y + dir[i].y*k - grav[i]*k*k;
+      next[i].z = pos[i].z + dir[i].z*k;
+      }
+
+    for(size_t i=0; i<n && i<body.size(); ++i) {
+      wrld.moveBullet(*body[i],next[i],k);
+      if(cb[i]!=nullptr)
+        cb[i]->onMove();
       }
     }
 
   void onMoveNpc(NpcBody& npc, NpcBodyList& list){
-    for(auto& i:body) {
-      btVector3 s = {i.lastPos.x,i.lastPos.y,i.lastPos.z};
-      btVector3 e = {i.pos.x,i.pos.y,i.pos.z};
+    for(size_t i=0; i<body.size(); ++i) {
+      btVector3 s = {lastPos[i].x,lastPos[i].y,lastPos[i].z};
+      btVector3 e = {pos[i].x,pos[i].y,pos[i].z};
 
-      if(i.cb!=nullptr && list.rayTest(npc,s,e)) {
-        i.cb->onCollide(*npc.getNpc());
-        i.cb->onStop();
+      if(cb[i]!=nullptr && list.rayTest(npc,s,e)) {
+        cb[i]->onCollide(*npc.getNpc());
+        cb[i]->onStop();
         }
       }
     }
 
-  std::list<BulletBody> body;
-  DynamicWorld&         wrld;
+  std::vector<BulletBody*>     body;
+  std::vector<BulletCallback*> cb;
+  std::vector<Tempest::Vec3>   pos;
+  std::vector<Tempest::Vec3>   lastPos;
+  std::vector<Tempest::Vec3>   dir;
+  std::vector<float>           dirL;
+  std::vector<float>           totalL;
+  std::vector<float>           grav;
+  std::vector<int>             spl;
+
+  std::vector<Tempest::Vec3>   next;
+  DynamicWorld&                wrld;
   };
 
 struct DynamicWorld::BBoxList final {
@@ -630,15 +673,29 @@ DynamicWorld::RayResult DynamicWorld::implWaterRay(float x0, float y0, float z0,
   }
 
 DynamicWorld::RayResult DynamicWorld::ray(float x0, float y0, float z0, float x1, float y1, float z1) const {
+  return implRay(btVector3(x0,y0,z0),btVector3(x1,y1,z1),(1u<<C_Landscape) | (1u<<C_Object));
+  }
+
+void DynamicWorld::ray(const RayQuery* q, RayResult* out, size_t count) const {
+  // static world is read-only during query, so rays are independent
+  Workers::parallelFor(out,out+count,[this,q,out](RayResult& r){
+    auto& rq = q[std::distance(out,&r)];
+    r = implRay(btVector3(rq.from.x,rq.from.y,rq.from.z),btVector3(rq.to.x,rq.to.y,rq.to.z),rq.mask);
+    });
+  }
+
+DynamicWorld::RayResult DynamicWorld::implRay(const btVector3& s, const btVector3& e, uint32_t mask) const {
   struct CallBack:btCollisionWorld::ClosestRayResultCallback {
     using ClosestRayResultCallback::ClosestRayResultCallback;
     uint8_t     matId  = 0;
     const char* sector = nullptr;
     Category    colCat = C_Null;
+    uint32_t    mask   = 0;
 
     bool needsCollision(btBroadphaseProxy* proxy0) const override {
       auto obj=reinterpret_cast<btCollisionObject*>(proxy0->m_clientObject);
-      if(obj->getUserIndex()==C_Landscape || obj->getUserIndex()==C_Object)
+      auto uid=obj->getUserIndex();
+      if(uid>=0 && uid<32 && (mask & (1u<<uid))!=0)
         return ClosestRayResultCallback::needsCollision(proxy0);
       return false;
       }
@@ -658,12 +715,13 @@ DynamicWorld::RayResult DynamicWorld::ray(float x0, float y0, float z0, float x1
       }
     };
 
-  btVector3 s(x0,y0,z0), e(x1,y1,z1);
   CallBack callback{s,e};
   callback.m_flags = btTriangleRaycastCallback::kF_KeepUnflippedNormal | btTriangleRaycastCallback::kF_FilterBackfaces;
+  callback.mask    = mask;
 
   rayTest(s,e,callback);
 
+  float x1=e.x(), y1=e.y(), z1=e.z();
   float nx=0,ny=1,nz=0;
   if(callback.hasHit()){
     x1 = callback.m_hitPointWorld.x();
@@ -810,25 +868,26 @@ DynamicWorld::StaticItem DynamicWorld::staticObj(const PhysicMeshShape *shape, c
   return StaticItem(this,obj.release());
   }
 
-DynamicWorld::BulletBody* DynamicWorld::bulletObj(BulletCallback* cb) {
-  return bulletList->add(cb);
+DynamicWorld::BulletBody DynamicWorld::bulletObj(BulletCallback* cb) {
+  return BulletBody(this,cb);
   }
 
 DynamicWorld::BBoxBody* DynamicWorld::bboxObj(BBoxCallback* cb, const ZMath::float3* bbox) {
   return bboxList->add(cb,bbox);
   }
 
-void DynamicWorld::moveBullet(BulletBody &b, float dx, float dy, float dz, uint64_t dt) {
-  float k  = float(dt)/1000.f;
+void DynamicWorld::moveBullet(BulletBody &b, const Tempest::Vec3& to, float k) {
+  auto&      list    = *bulletList;
+  auto*      cb      = list.cb[b.id];
   const bool isSpell = b.isSpell();
 
-  auto  p  = b.pos;
+  auto  p  = b.position();
   float x0 = p.x;
   float y0 = p.y;
   float z0 = p.z;
-  float x1 = x0+dx*k;
-  float y1 = y0+dy*k - (isSpell ? 0 : gravity*k*k);
-  float z1 = z0+dz*k;
+  float x1 = to.x;
+  float y1 = to.y;
+  float z1 = to.z;
 
   struct CallBack:btCollisionWorld::ClosestRayResultCallback {
     using ClosestRayResultCallback::ClosestRayResultCallback;
@@ -865,9 +924,9 @@ void DynamicWorld::moveBullet(BulletBody &b, float dx, float dy, float dz, uint6
     }
 
   if(auto ptr = npcList->rayTest(s,e)) {
-    if(b.cb!=nullptr) {
-      b.cb->onCollide(*ptr->getNpc());
-      b.cb->onStop();
+    if(cb!=nullptr) {
+      cb->onCollide(*ptr->getNpc());
+      cb->onStop();
       }
     return;
     }
@@ -875,14 +934,14 @@ void DynamicWorld::moveBullet(BulletBody &b, float dx, float dy, float dz, uint6
 
   if(callback.matId<ZenLoad::NUM_MAT_GROUPS) {
     if( isSpell ){
-      if(b.cb!=nullptr) {
-        b.cb->onCollide(callback.matId);
-        b.cb->onStop();
+      if(cb!=nullptr) {
+        cb->onCollide(callback.matId);
+        cb->onStop();
         }
       } else {
       if(callback.matId==ZenLoad::MaterialGroup::METAL ||
          callback.matId==ZenLoad::MaterialGroup::STONE) {
-        auto d = b.dir;
+        auto d = b.direction();
         btVector3 m = {d.x,d.y,d.z};
         btVector3 n = callback.m_hitNormalWorld;
 
@@ -903,16 +962,15 @@ void DynamicWorld::moveBullet(BulletBody &b, float dx, float dy, float dz, uint6
         float a = callback.m_closestHitFraction;
         b.move(x0+(x1-x0)*a,y0+(y1-y0)*a,z0+(z1-z0)*a);
         }
-      if(b.cb!=nullptr) {
-        b.cb->onCollide(callback.matId);
-        b.cb->onStop();
+      if(cb!=nullptr) {
+        cb->onCollide(callback.matId);
+        cb->onStop();
         }
       }
     } else {
     const float l = b.speed();
     auto d = b.direction();
-    if(!isSpell)
-      d.y -= gravity*k;
+    d.y -= list.grav[b.id]*k;
 
     b.move(x1,y1,z1);
     b.setDirection(d.x,d.y,d.z);
@@ -946,10 +1004,6 @@ void DynamicWorld::deleteObj(NpcBody *obj) {
   delete obj;
   }
 
-void DynamicWorld::deleteObj(BulletBody* obj) {
-  bulletList->del(obj);
-  }
-
 void DynamicWorld::deleteObj(DynamicWorld::BBoxBody* obj) {
   bboxList->del(obj);
   }
@@ -1149,44 +1203,96 @@ void DynamicWorld::StaticItem::setObjMatrix(const Tempest::Matrix4x4 &m) {
   }
 
 DynamicWorld::BulletBody::BulletBody(DynamicWorld* wrld, DynamicWorld::BulletCallback* cb)
-  :owner(wrld), cb(cb) {
+  :owner(wrld) {
+  id = owner->bulletList->add(this,cb);
   }
 
 DynamicWorld::BulletBody::BulletBody(DynamicWorld::BulletBody&& other)
-  : pos(other.pos), lastPos(other.lastPos),
-    dir(other.dir), dirL(other.dirL), totalL(other.totalL), spl(other.spl){
+  :owner(other.owner), id(other.id) {
+  other.owner = nullptr;
+  if(owner!=nullptr)
+    owner->bulletList->body[id] = this;
+  }
+
+DynamicWorld::BulletBody::~BulletBody() {
+  if(owner!=nullptr)
+    owner->bulletList->del(id);
+  }
+
+DynamicWorld::BulletBody& DynamicWorld::BulletBody::operator =(DynamicWorld::BulletBody&& other) {
   std::swap(owner,other.owner);
-  std::swap(cb,other.cb);
+  std::swap(id,   other.id);
+  if(owner!=nullptr)
+    owner->bulletList->body[id] = this;
+  if(other.owner!=nullptr)
+    other.owner->bulletList->body[other.id] = &other;
+  return *this;
+  }
+
+void DynamicWorld::BulletBody::setCallback(BulletCallback* cb) {
+  if(owner!=nullptr)
+    owner->bulletList->cb[id] = cb;
   }
 
 void DynamicWorld::BulletBody::setSpellId(int s) {
-  spl = s;
+  auto& l = *owner->bulletList;
+  l.spl [id] = s;
+  l.grav[id] = isSpell() ? 0.f : float(gravity);
   }
 
 void DynamicWorld::BulletBody::move(float x, float y, float z) {
-  lastPos = pos;
-  pos     = {x,y,z};
+  auto& l = *owner->bulletList;
+  l.lastPos[id] = l.pos[id];
+  l.pos    [id] = {x,y,z};
   }
 
 void DynamicWorld::BulletBody::setPosition(float x, float y, float z) {
-  lastPos = {x,y,z};
-  pos     = {x,y,z};
+  auto& l = *owner->bulletList;
+  l.lastPos[id] = {x,y,z};
+  l.pos    [id] = {x,y,z};
   }
 
 void DynamicWorld::BulletBody::setDirection(float x, float y, float z) {
-  dir  = {x,y,z};
-  dirL = std::sqrt(x*x + y*y + z*z);
+  auto& l = *owner->bulletList;
+  l.dir [id] = {x,y,z};
+  l.dirL[id] = std::sqrt(x*x + y*y + z*z);
   }
 
 float DynamicWorld::BulletBody::pathLength() const {
-  return totalL;
+  return owner->bulletList->totalL[id];
   }
 
 void DynamicWorld::BulletBody::addPathLen(float v) {
-  totalL += v;
+  owner->bulletList->totalL[id] += v;
+  }
+
+float DynamicWorld::BulletBody::speed() const {
+  return owner->bulletList->dirL[id];
+  }
+
+Tempest::Vec3 DynamicWorld::BulletBody::position() const {
+  return owner->bulletList->pos[id];
+  }
+
+Tempest::Vec3 DynamicWorld::BulletBody::direction() const {
+  return owner->bulletList->dir[id];
+  }
+
+int DynamicWorld::BulletBody::spellId() const {
+  return owner->bulletList->spl[id];
   }
 
 Tempest::Matrix4x4 DynamicWorld::BulletBody::matrix() const {
+  return matrix(1.f);
+  }
+
+Tempest::Matrix4x4 DynamicWorld::BulletBody::matrix(float alpha) const {
+  // alpha blends between position before and after last move
+  auto& l    = *owner->bulletList;
+  auto  dir  = l.dir[id];
+  auto  pos  = l.lastPos[id] + (l.pos[id]-l.lastPos[id])*alpha;
+  float dirL = l.dirL[id];
+
   const float dx = dir.x/dirL;
   const float dy = dir.y/dirL;
   const float dz = dir.z/dirL;
@@ -128,6 +128,12 @@ class DynamicWorld final {
       float               z() const { return v.z; }
       };
 
+    struct RayQuery final {
+      Tempest::Vec3       from={};
+      Tempest::Vec3       to  ={};
+      uint32_t            mask=(1u<<C_Landscape) | (1u<<C_Object); // bit per Category, to collide with
+      };
+
     struct BulletCallback {
       virtual ~BulletCallback()=default;
       virtual void onStop(){}
@@ -136,11 +142,16 @@ class DynamicWorld final {
       virtual void onCollide(Npc& other){(void)other;}
       };
 
+    // handle to a slot in the bullet pool; slot data lives in BulletsList arrays
     struct BulletBody final {
       public:
-        BulletBody(DynamicWorld* wrld,BulletCallback* cb);
-        BulletBody(BulletBody&&);
+        BulletBody()=default;
+        BulletBody(BulletBody&& other);
+        ~BulletBody();
+
+        BulletBody& operator = (BulletBody&& other);
 
+        void  setCallback(BulletCallback* cb);
         void  setSpellId(int spl);
 
         void  move(float x,float y,float z);
@@ -149,24 +160,19 @@ class DynamicWorld final {
         float pathLength() const;
         void  addPathLen(float v);
 
-        float               speed()     const { return dirL; }
-        Tempest::Vec3       position()  const { return pos; }
-        Tempest::Vec3       direction() const { return dir; }
+        float               speed()     const;
+        Tempest::Vec3       position()  const;
+        Tempest::Vec3       direction() const;
         Tempest::Matrix4x4  matrix()    const;
-        bool                isSpell()   const { return spl!=std::numeric_limits<int>::max(); }
-        int                 spellId()   const { return spl; }
+        Tempest::Matrix4x4  matrix(float alpha) const;
+        bool                isSpell()   const { return spellId()!=std::numeric_limits<int>::max(); }
+        int                 spellId()   const;
 
       private:
-        DynamicWorld*       owner = nullptr;
-        BulletCallback*     cb    = nullptr;
-
-        Tempest::Vec3       pos={};
-        Tempest::Vec3       lastPos={};
+        BulletBody(DynamicWorld* wrld,BulletCallback* cb);
 
-        Tempest::Vec3       dir={};
-        float               dirL=0.f;
-        float               totalL=0.f;
-        int                 spl=std::numeric_limits<int>::max();
+        DynamicWorld*       owner = nullptr;
+        uint32_t            id    = 0;
 
       friend class DynamicWorld;
       };
@@ -196,18 +202,18 @@ class DynamicWorld final {
     RayResult   waterRay(float x, float y, float z) const;
 
     RayResult   ray          (float x0, float y0, float z0, float x1, float y1, float z1) const;
+    void        ray          (const RayQuery* q, RayResult* out, size_t count) const;
     float       soundOclusion(float x0, float y0, float z0, float x1, float y1, float z1) const;
 
     Tempest::Vec3 landNormal(float x, float y, float z) const;
 
     Item        ghostObj (const ZMath::float3& min,const ZMath::float3& max);
     StaticItem  staticObj(const PhysicMeshShape *src, const Tempest::Matrix4x4& m);
-    BulletBody* bulletObj(BulletCallback* cb);
+    BulletBody  bulletObj(BulletCallback* cb);
     BBoxBody*   bboxObj(BBoxCallback* cb, const ZMath::float3* bbox);
 
     void        tick(uint64_t dt);
 
-    void        deleteObj(BulletBody* obj);
     void        deleteObj(BBoxBody*   obj);
 
     const char* validateSectorName(const char* name) const;
@@ -217,8 +223,9 @@ class DynamicWorld final {
     void        deleteObj(btCollisionObject* obj);
 
 
-    void       moveBullet(BulletBody& b, float dx, float dy, float dz, uint64_t dt);
+    void       moveBullet(BulletBody& b, const Tempest::Vec3& to, float k);
     RayResult  implWaterRay (float x0, float y0, float z0, float x1, float y1, float z1) const;
+    RayResult  implRay      (const btVector3& s, const btVector3& e, uint32_t mask) const;
     bool       hasCollision(const Item &it, Tempest::Vec3& normal);
 
     template<class RayResultCallback>
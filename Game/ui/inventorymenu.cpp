@@ -222,7 +222,7 @@ void InventoryMenu::processMove(KeyEvent& e) {
 
 void InventoryMenu::processPickLock(KeyEvent& e) {
   auto&        script        = world()->script();
-  const size_t ItKE_lockpick = script.getSymbolIndex("ItKE_lockpick");
+  const size_t ItKE_lockpick = script.lockPickId();
 
   auto k  = keycodec.tr(e);
   char ch = '\0';
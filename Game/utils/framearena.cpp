@@ -0,0 +1,63 @@
+#include "framearena.h"
+
+#include <algorithm>
+
+FrameArena& FrameArena::local() {
+  thread_local FrameArena a;
+  return a;
+  }
+
+void* FrameArena::alloc(size_t size, size_t align) {
+  if(size==0)
+    size = 1;
+  if(chunks.size()>0) {
+    auto&  c   = chunks.back();
+    auto   at  = reinterpret_cast<uintptr_t>(c.data.get())+top;
+    size_t pad = (align - at%align)%align;
+    if(top+pad+size<=c.size) {
+      top += pad+size;
+      ++live;
+      return c.data.get()+top-size;
+      }
+    }
+
+  Chunk c;
+  c.size = std::max<size_t>(ChunkSize,size+align);
+  if(chunks.size()>0)
+    c.size = std::max(c.size,chunks.back().size*2);
+  c.data.reset(new uint8_t[c.size]);
+  chunks.emplace_back(std::move(c));
+  top = 0;
+  return alloc(size,align);
+  }
+
+void FrameArena::free(void* p, size_t size) {
+  if(size==0)
+    size = 1;
+  --live;
+  if(live==0) {
+    rewind();
+    return;
+    }
+  // pop the most recent allocation
+  auto& c = chunks.back();
+  auto  b = reinterpret_cast<uint8_t*>(p);
+  if(b+size==c.data.get()+top)
+    top = size_t(b-c.data.get());
+  }
+
+void FrameArena::rewind() {
+  top = 0;
+  if(chunks.size()<=1)
+    return;
+  // frame didn't fit into one chunk - replace with a single one, large enough for next time
+  size_t total = 0;
+  for(auto& i:chunks)
+    total += i.size;
+  chunks.clear();
+
+  Chunk c;
+  c.size = total;
+  c.data.reset(new uint8_t[c.size]);
+  chunks.emplace_back(std::move(c));
+  }
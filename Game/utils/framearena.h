@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Per-thread bump allocator for data, that lives no longer than a frame.
+// Memory is rewound once the last live allocation of the thread is released.
+// Containers must be created, used and destroyed on the same thread.
+class FrameArena final {
+  public:
+    FrameArena(const FrameArena&)=delete;
+
+    static FrameArena& local();
+
+    void* alloc(size_t size, size_t align);
+    void  free (void* p, size_t size);
+
+    template<class T>
+    struct Allocator {
+      using value_type = T;
+
+      Allocator():arena(&FrameArena::local()){}
+      template<class U>
+      Allocator(const Allocator<U>& a):arena(a.arena){}
+
+      T*   allocate  (size_t n)       { return reinterpret_cast<T*>(arena->alloc(n*sizeof(T),alignof(T))); }
+      void deallocate(T* p, size_t n) { arena->free(p,n*sizeof(T)); }
+
+      template<class U>
+      bool operator == (const Allocator<U>& a) const { return arena==a.arena; }
+      template<class U>
+      bool operator != (const Allocator<U>& a) const { return arena!=a.arena; }
+
+      FrameArena* arena = nullptr;
+      };
+
+  private:
+    FrameArena()=default;
+
+    enum { ChunkSize = 256*1024 };
+
+    struct Chunk final {
+      std::unique_ptr<uint8_t[]> data;
+      size_t                     size = 0;
+      };
+
+    void rewind();
+
+    std::vector<Chunk> chunks;
+    size_t             top  = 0;
+    size_t             live = 0;
+  };
+
+template<class T>
+using FrameVector = std::vector<T,FrameArena::Allocator<T>>;
@@ -0,0 +1,107 @@
+#include "bboxtree.h"
+
+#include <algorithm>
+
+using namespace Tempest;
+
+static Vec3 vmin(const Vec3& a, const Vec3& b) {
+  return Vec3(std::min(a.x,b.x),std::min(a.y,b.y),std::min(a.z,b.z));
+  }
+
+static Vec3 vmax(const Vec3& a, const Vec3& b) {
+  return Vec3(std::max(a.x,b.x),std::max(a.y,b.y),std::max(a.z,b.z));
+  }
+
+void BaseBBoxTree::clear() {
+  items.clear();
+  nodes.clear();
+  }
+
+void BaseBBoxTree::add(const Vec3& min, const Vec3& max, void* obj) {
+  Item it;
+  it.min = min;
+  it.max = max;
+  it.obj = obj;
+  items.push_back(it);
+  nodes.clear();
+  }
+
+void BaseBBoxTree::find(const Vec3& p, void* ctx, void (*func)(void*, void*)) {
+  find(p,p,ctx,func);
+  }
+
+void BaseBBoxTree::find(const Vec3& min, const Vec3& max, void* ctx, void (*func)(void*, void*)) {
+  if(items.size()==0)
+    return;
+  if(nodes.size()==0)
+    buildIndex();
+  implFind(0,min,max,ctx,func);
+  }
+
+void BaseBBoxTree::buildIndex() {
+  nodes.reserve(2*items.size()/LeafSize+1);
+  nodes.emplace_back();
+  buildIndex(0,0,uint32_t(items.size()));
+  }
+
+void BaseBBoxTree::buildIndex(uint32_t id, uint32_t first, uint32_t count) {
+  Vec3 bbox[2] = {items[first].min, items[first].max};
+  Vec3 cen [2] = {(items[first].min+items[first].max)*0.5f, (items[first].min+items[first].max)*0.5f};
+  for(uint32_t i=first+1; i<first+count; ++i) {
+    auto c = (items[i].min+items[i].max)*0.5f;
+    bbox[0] = vmin(bbox[0],items[i].min);
+    bbox[1] = vmax(bbox[1],items[i].max);
+    cen [0] = vmin(cen[0],c);
+    cen [1] = vmax(cen[1],c);
+    }
+  nodes[id].min = bbox[0];
+  nodes[id].max = bbox[1];
+
+  if(count<=LeafSize) {
+    nodes[id].first = first;
+    nodes[id].count = count;
+    return;
+    }
+
+  // split by median along largest extent of centers
+  auto ext = cen[1]-cen[0];
+  auto b   = items.begin()+int(first);
+  auto mid = items.begin()+int(first+count/2);
+  auto e   = items.begin()+int(first+count);
+  if(ext.x>=ext.y && ext.x>=ext.z)
+    std::nth_element(b,mid,e,[](const Item& l, const Item& r){ return l.min.x+l.max.x < r.min.x+r.max.x; }); else
+  if(ext.y>=ext.z)
+    std::nth_element(b,mid,e,[](const Item& l, const Item& r){ return l.min.y+l.max.y < r.min.y+r.max.y; }); else
+    std::nth_element(b,mid,e,[](const Item& l, const Item& r){ return l.min.z+l.max.z < r.min.z+r.max.z; });
+
+  const uint32_t left = uint32_t(nodes.size());
+  nodes.resize(nodes.size()+2);
+  nodes[id].first = left;
+  nodes[id].count = 0;
+
+  buildIndex(left,  first,        count/2);
+  buildIndex(left+1,first+count/2,count-count/2);
+  }
+
+void BaseBBoxTree::implFind(uint32_t id, const Vec3& min, const Vec3& max, void* ctx, void (*func)(void*, void*)) const {
+  auto& n = nodes[id];
+  if(max.x<n.min.x || n.max.x<min.x ||
+     max.y<n.min.y || n.max.y<min.y ||
+     max.z<n.min.z || n.max.z<min.z)
+    return;
+
+  if(n.count==0) {
+    implFind(n.first,  min,max,ctx,func);
+    implFind(n.first+1,min,max,ctx,func);
+    return;
+    }
+
+  for(uint32_t i=n.first; i<n.first+n.count; ++i) {
+    auto& it = items[i];
+    if(max.x<it.min.x || it.max.x<min.x ||
+       max.y<it.min.y || it.max.y<min.y ||
+       max.z<it.min.z || it.max.z<min.z)
+      continue;
+    func(ctx,it.obj);
+    }
+  }
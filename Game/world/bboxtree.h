@@ -0,0 +1,66 @@
+#pragma once
+
+#include <Tempest/Vec>
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class BaseBBoxTree {
+  public:
+    void   clear();
+    size_t size() const { return items.size(); }
+
+  protected:
+    BaseBBoxTree() = default;
+    void add(const Tempest::Vec3& min, const Tempest::Vec3& max, void* obj);
+    void find(const Tempest::Vec3& p, void* ctx, void (*func)(void*, void*));
+    void find(const Tempest::Vec3& min, const Tempest::Vec3& max, void* ctx, void (*func)(void*, void*));
+
+  private:
+    enum { LeafSize = 4 };
+
+    struct Item final {
+      Tempest::Vec3 min, max;
+      void*         obj = nullptr;
+      };
+
+    struct Node final {
+      Tempest::Vec3 min, max;
+      uint32_t      first = 0; // first item for leaf, left child otherwise; right child is left+1
+      uint32_t      count = 0; // 0 for inner node
+      };
+
+    std::vector<Item> items;
+    std::vector<Node> nodes;
+
+    void     buildIndex();
+    void     buildIndex(uint32_t id, uint32_t first, uint32_t count);
+    void     implFind(uint32_t node, const Tempest::Vec3& min, const Tempest::Vec3& max, void* ctx, void (*func)(void*, void*)) const;
+  };
+
+template<class T>
+class BBoxTree final : public BaseBBoxTree {
+  public:
+    BBoxTree()=default;
+
+    void add(const Tempest::Vec3& min, const Tempest::Vec3& max, T* obj) {
+      BaseBBoxTree::add(min,max,obj);
+      }
+
+    template<class Func>
+    void find(const Tempest::Vec3& p, Func f) {
+      BaseBBoxTree::find(p,&f,[](void* ctx, void* v){
+        auto& f = *reinterpret_cast<Func*>(ctx);
+        f(*reinterpret_cast<T*>(v));
+        });
+      }
+
+    template<class Func>
+    void find(const Tempest::Vec3& min, const Tempest::Vec3& max, Func f) {
+      BaseBBoxTree::find(min,max,&f,[](void* ctx, void* v){
+        auto& f = *reinterpret_cast<Func*>(ctx);
+        f(*reinterpret_cast<T*>(v));
+        });
+      }
+  };
@@ -7,7 +7,7 @@ Bullet::Bullet(World& owner,const Item& itm,float x,float y,float z)
   :wrld(&owner) {
   obj = wrld->physic()->bulletObj(this);
   if(itm.isSpellOrRune()) {
-    obj->setSpellId(itm.spellId());
+    obj.setSpellId(itm.spellId());
     }
 
   if(itm.isSpellOrRune()) {
@@ -27,22 +27,43 @@ Bullet::Bullet(World& owner,const Item& itm,float x,float y,float z)
   setPosition(x,y,z);
   }
 
+Bullet::Bullet(Bullet&& other)
+  :obj(std::move(other.obj)), wrld(other.wrld), ow(other.ow), dmg(other.dmg), hitCh(other.hitCh),
+   view(std::move(other.view)), pfx(std::move(other.pfx)), material(other.material), flg(other.flg) {
+  obj.setCallback(this);
+  }
+
 Bullet::~Bullet() {
-  wrld->physic()->deleteObj(obj);
+  }
+
+Bullet& Bullet::operator=(Bullet&& other) {
+  obj      = std::move(other.obj);
+  wrld     = other.wrld;
+  ow       = other.ow;
+  dmg      = other.dmg;
+  hitCh    = other.hitCh;
+  view     = std::move(other.view);
+  pfx      = std::move(other.pfx);
+  material = other.material;
+  flg      = other.flg;
+
+  obj.setCallback(this);
+  other.obj.setCallback(&other);
+  return *this;
   }
 
 void Bullet::setPosition(const Tempest::Vec3& p) {
-  obj->setPosition(p.x,p.y,p.z);
+  obj.setPosition(p.x,p.y,p.z);
   updateMatrix();
   }
 
 void Bullet::setPosition(float x, float y, float z) {
-  obj->setPosition(x,y,z);
+  obj.setPosition(x,y,z);
   updateMatrix();
   }
 
 void Bullet::setDirection(float x, float y, float z) {
-  obj->setDirection(x,y,z);
+  obj.setDirection(x,y,z);
   updateMatrix();
   }
 
@@ -58,11 +79,11 @@ void Bullet::setView(PfxObjects::Emitter &&p) {
   }
 
 bool Bullet::isSpell() const {
-  return obj->isSpell();
+  return obj.isSpell();
   }
 
 int32_t Bullet::spellId() const {
-  return obj->spellId();
+  return obj.spellId();
   }
 
 void Bullet::setOwner(Npc *n) {
@@ -74,7 +95,7 @@ Npc *Bullet::owner() const {
   }
 
 float Bullet::pathLength() const {
-  return obj->pathLength();
+  return obj.pathLength();
   }
 
 void Bullet::onStop() {
@@ -89,7 +110,7 @@ void Bullet::onMove() {
 void Bullet::onCollide(uint8_t matId) {
   if(matId<ZenLoad::NUM_MAT_GROUPS) {
     if(material<ZenLoad::NUM_MAT_GROUPS) {
-      auto pos = obj->position();
+      auto pos = obj.position();
       wrld->emitLandHitSound(pos.x,pos.y,pos.z,material,matId);
       }
     }
@@ -103,19 +124,25 @@ void Bullet::onCollide(Npc& npc) {
   }
 
 void Bullet::collideCommon() {
-  if(obj->isSpell()) {
-    const int32_t     id  = obj->spellId();
+  if(obj.isSpell()) {
+    const int32_t     id  = obj.spellId();
     const VisualFx*   vfx = wrld->script().getSpellVFx(id);
 
     if(vfx!=nullptr) {
-      auto pos = obj->position();
+      auto pos = obj.position();
       vfx->emitSound(*wrld,pos,SpellFxKey::Collide);
       }
     }
   }
 
+void Bullet::updateAnimation() {
+  auto mat = obj.matrix(wrld->interpolation());
+  view.setObjMatrix(mat);
+  pfx .setObjMatrix(mat);
+  }
+
 void Bullet::updateMatrix() {
-  auto mat = obj->matrix();
+  auto mat = obj.matrix();
   view.setObjMatrix(mat);
   pfx .setObjMatrix(mat);
   }
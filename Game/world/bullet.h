@@ -15,9 +15,9 @@ class Bullet final : public DynamicWorld::BulletCallback {
   public:
     Bullet()=default;
     Bullet(World &owner, const Item &itm, float x, float y, float z);
-    Bullet(Bullet&&)=default;
+    Bullet(Bullet&& other);
     ~Bullet() override;
-    Bullet& operator=(Bullet&&)=default;
+    Bullet& operator=(Bullet&& other);
 
     enum Flg:uint8_t {
       NoFlags = 0,
@@ -49,6 +49,7 @@ class Bullet final : public DynamicWorld::BulletCallback {
     void                       setHitChance(float h) { hitCh=h; }
 
     float                      pathLength() const;
+    void                       updateAnimation();
 
   protected:
     void                       onStop() override;
@@ -58,7 +59,7 @@ class Bullet final : public DynamicWorld::BulletCallback {
     void                       collideCommon();
 
   private:
-    DynamicWorld::BulletBody*         obj=nullptr;
+    DynamicWorld::BulletBody          obj;
     World*                            wrld=nullptr;
     Npc*                              ow=nullptr;
 
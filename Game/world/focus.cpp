@@ -7,10 +7,10 @@
 Focus::Focus(Interactive &i):interactive(&i){
   }
 
-Focus::Focus(Npc &i):npc(&i){
+Focus::Focus(Npc &i):npc(&i),hNpc(i.objHandle()){
   }
 
-Focus::Focus(Item &i):item(&i){
+Focus::Focus(Item &i):item(&i),hItem(i.objHandle()){
   }
 
 Focus::operator bool() const {
@@ -2,6 +2,8 @@
 
 #include <Tempest/Point>
 
+#include "handletable.h"
+
 class Interactive;
 class Npc;
 class Item;
@@ -20,4 +22,5 @@ class Focus final {
     Interactive* interactive=nullptr;
     Npc*         npc        =nullptr;
     Item*        item       =nullptr;
+    ObjHandle    hNpc, hItem;
   };
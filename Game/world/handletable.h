@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+struct ObjHandle final {
+  uint32_t id  = uint32_t(-1);
+  uint32_t gen = 0;
+  };
+
+// Slot map with generation counters: stale handles resolve to null in O(1).
+// T must provide objHandle()/setObjHandle(ObjHandle).
+template<class T>
+class HandleTable final {
+  public:
+    HandleTable()=default;
+
+    void insert(T& obj) {
+      uint32_t id = 0;
+      if(freeList.size()>0) {
+        id = freeList.back();
+        freeList.pop_back();
+        } else {
+        id = uint32_t(slot.size());
+        slot.emplace_back();
+        }
+      slot[id].obj = &obj;
+      obj.setObjHandle(ObjHandle{id,slot[id].gen});
+      }
+
+    void erase(T& obj) {
+      auto h = obj.objHandle();
+      if(get(h)!=&obj)
+        return;
+      slot[h.id].obj = nullptr;
+      slot[h.id].gen++;
+      freeList.push_back(h.id);
+      obj.setObjHandle(ObjHandle());
+      }
+
+    T* get(ObjHandle h) const {
+      if(h.id>=slot.size() || slot[h.id].gen!=h.gen)
+        return nullptr;
+      return slot[h.id].obj;
+      }
+
+  private:
+    struct Slot final {
+      T*       obj = nullptr;
+      uint32_t gen = 0;
+      };
+
+    std::vector<Slot>     slot;
+    std::vector<uint32_t> freeList;
+  };
@@ -467,8 +467,7 @@ bool Interactive::checkUseConditions(Npc& npc) {
     }
 
   if(isPlayer) {
-    const size_t ItKE_lockpick  = world.getSymbolIndex("ItKE_lockpick");
-    const size_t lockPickCnt    = npc.inventory().itemCount(ItKE_lockpick);
+    const size_t lockPickCnt    = npc.inventory().itemCount(world.script().lockPickId());
     const bool   canLockPick    = (npc.talentSkill(Npc::TALENT_PICKLOCK)!=0 && lockPickCnt>0);
 
     const size_t keyInst        = keyInstance.empty() ? size_t(-1) : world.getSymbolIndex(keyInstance.c_str());
@@ -792,6 +791,10 @@ void Interactive::moveEvent() {
   visual.setPos(transform());
   }
 
+void Interactive::renderEvent(const Tempest::Matrix4x4& tr) {
+  visual.setPos(tr);
+  }
+
 const char *Interactive::Pos::posTag() const {
   if(name.rfind("_FRONT")==name.size()-6)
     return "_FRONT";
@@ -86,6 +86,7 @@ class Interactive : public Vob {
       };
 
     void                moveEvent() override;
+    void                renderEvent(const Tempest::Matrix4x4& tr) override;
     void                setVisual(const std::string& visual);
     void                invokeStateFunc(Npc &npc);
     void                implTick(Pos &p, uint64_t dt);
@@ -3,6 +3,7 @@
 #include <daedalus/DaedalusVM.h>
 
 #include "graphics/meshobjects.h"
+#include "handletable.h"
 #include "vob.h"
 
 class World;
@@ -65,11 +66,14 @@ class Item final : public Vob {
     const Daedalus::GEngineClasses::C_Item* handle() const { return &hitem; }
     Daedalus::GEngineClasses::C_Item*       handle() { return &hitem; }
     size_t                                  clsId() const;
+    ObjHandle                               objHandle() const { return hObj; }
+    void                                    setObjHandle(ObjHandle h) { hObj = h; }
 
   private:
     void updateMatrix();
 
     Daedalus::GEngineClasses::C_Item  hitem={};
+    ObjHandle                         hObj;
     MeshObjects::Mesh                 view;
     Tempest::Vec3                     pos={};
     bool                              equiped=false;
@@ -20,6 +20,8 @@
 
 using namespace Tempest;
 
+static const uint64_t maxMoveDt = 250; // larger steps would let far npc's walk through walls
+
 void Npc::GoTo::save(Serialize& fout) const {
   fout.write(npc, uint8_t(flag), wp);
   }
@@ -77,6 +79,7 @@ Npc::Npc(World &owner, Serialize &fin)
 Npc::~Npc(){
   if(currentInteract)
     currentInteract->dettach(*this,true);
+  owner.cancelWayTo(*this);
   owner.script().clearReferences(hnpc);
   assert(hnpc.useCount==0);
   }
@@ -466,7 +469,7 @@ bool Npc::checkHealth(bool onChange,bool allowUnconscious) {
   const int minHp = isMonster() ? 0 : 1;
   if(hnpc.attribute[ATR_HITPOINTS]<=minHp) {
     if(hnpc.attribute[ATR_HITPOINTSMAX]<=1) {
-      size_t fdead=owner.getSymbolIndex("ZS_Dead");
+      size_t fdead=owner.script().deadState();
       startState(fdead,"");
       physic.setEnable(false);
       return false;
@@ -499,12 +502,11 @@ void Npc::onNoHealth(bool death,HitSound sndMask) {
   clearAiQueue();
 
   const char* svm   = death ? "SVM_%d_DEAD" : "SVM_%d_AARGH";
-  const char* state = death ? "ZS_Dead"     : "ZS_Unconscious";
 
   if(!death)
     hnpc.attribute[ATR_HITPOINTS]=1;
 
-  size_t fdead=owner.getSymbolIndex(state);
+  size_t fdead=death ? owner.script().deadState() : owner.script().unconsciousState();
   startState(fdead,"",gtime::endOfTime(),true);
   if(hnpc.voice>0 && sndMask!=HS_NoSound) {
     char name[32]={};
@@ -631,8 +633,14 @@ void Npc::updateAnimation() {
     visual.setTarget(currentTarget->position()); else
     visual.setTarget(position());
 
+  auto at  = renderPosition();
+  auto rot = renderRotation();
+  if(at!=drawPos)
+    durtyTranform |= TR_Pos;
+  if(rot!=drawAngle)
+    durtyTranform |= TR_Rot;
   if(durtyTranform){
-    updatePos();
+    updatePos(at,rot);
     durtyTranform=0;
     }
   visual.updateAnimation(this,owner);
@@ -640,7 +648,7 @@ void Npc::updateAnimation() {
 
 void Npc::updateTransform() {
   if(durtyTranform){
-    updatePos();
+    updatePos(position(),angle);
     visual.syncAttaches();
     durtyTranform=0;
     }
@@ -1608,10 +1616,27 @@ Npc* Npc::updateNearestBody() {
   return ret;
   }
 
-void Npc::tick(uint64_t dt) {
-  Animation::EvCount ev;
-  visual.pose().processEvents(lastEventTime,owner.tickCount(),ev);
+void Npc::tickAnimation() {
+  // touches only own pose - safe to run in parallel for all npc's
+  if(!tickEvReady)
+    tickEv = Animation::EvCount(); // otherwise accumulate, tick was postponed
+  visual.pose().processEvents(lastEventTime,owner.tickCount(),tickEv);
   visual.processLayers(owner,calcAniComb());
+  tickEvReady = true;
+  }
+
+void Npc::skipTick(uint64_t dt) {
+  tickSkip += dt;
+  }
+
+void Npc::tick(uint64_t dt) {
+  if(!tickEvReady)
+    tickAnimation(); // spawned in middle of frame
+  tickEvReady = false;
+  auto& ev = tickEv;
+  dt      += tickSkip;
+  tickSkip = 0;
+
   if(!visual.pose().hasAnim())
     setAnim(AnimationSolver::Idle);
 
@@ -1650,6 +1675,15 @@ void Npc::tick(uint64_t dt) {
   if(!ev.timed.empty())
     tickTimedEvt(ev);
 
+  // regen and dive timers take the whole skipped time, movement and ai go in bounded steps
+  while(dt>maxMoveDt) {
+    tickMove(maxMoveDt);
+    dt -= maxMoveDt;
+    }
+  tickMove(dt);
+  }
+
+void Npc::tickMove(uint64_t dt) {
   if(waitTime>=owner.tickCount() || aniWaitTime>=owner.tickCount()) {
     if(faiWaitTime<owner.tickCount())
       adjustAtackRotation(dt);
@@ -1733,7 +1767,11 @@ void Npc::nextAiAction(uint64_t dt) {
         break;
         }
       if(wayPath.last()!=act.point) {
-        wayPath     = owner.wayTo(*this,*act.point);
+        if(!owner.pollWayTo(*this,*act.point,wayPath)) {
+          // path is computed asynchronously - idle until it's ready
+          aiActions.push_front(std::move(act));
+          break;
+          }
         auto wpoint = wayPath.pop();
 
         if(wpoint!=nullptr) {
@@ -2710,6 +2748,21 @@ void Npc::startDialog(Npc& pl) {
     setOther(&pl);
   }
 
+void Npc::perceptionSense(const Npc& pl) {
+  // range, room and line-of-sight queries only - safe to run in parallel for all npc's
+  percSensePl = SensesBit::SENSE_NONE;
+  percBody    = nullptr;
+  percSensed  = true;
+  if(isPlayer() || processPolicy()!=Npc::AiNormal)
+    return;
+  if(hasPerc(PERC_ASSESSPLAYER))
+    percSensePl = canSenseNpc(pl,false);
+  if(hasPerc(PERC_ASSESSENEMY))
+    updateNearestEnemy();
+  if(hasPerc(PERC_ASSESSBODY))
+    percBody = updateNearestBody();
+  }
+
 bool Npc::perceptionProcess(Npc &pl) {
   static bool disable=false;
   if(disable)
@@ -2718,6 +2771,10 @@ bool Npc::perceptionProcess(Npc &pl) {
   if(isPlayer())
     return true;
 
+  if(!percSensed)
+    perceptionSense(pl);
+  percSensed = false;
+
   bool ret=false;
   if(hasPerc(PERC_MOVEMOB) && interactive()==nullptr) {
     if(moveMobCacheKey!=position()) {
@@ -2734,12 +2791,15 @@ bool Npc::perceptionProcess(Npc &pl) {
 
   const float quadDist = pl.qDistTo(*this);
 
-  if(hasPerc(PERC_ASSESSPLAYER) && canSenseNpc(pl,false)!=SensesBit::SENSE_NONE) {
+  if(hasPerc(PERC_ASSESSPLAYER) && percSensePl!=SensesBit::SENSE_NONE) {
     if(perceptionProcess(pl,nullptr,quadDist,PERC_ASSESSPLAYER)) {
       ret = true;
       }
     }
-  Npc* enem=hasPerc(PERC_ASSESSENEMY) ? updateNearestEnemy() : nullptr;
+  // scripts of other npc's run since sensing - enemy and body may be gone meanwhile
+  Npc* enem=hasPerc(PERC_ASSESSENEMY) ? nearestEnemy : nullptr;
+  if(enem!=nullptr && enem->isDown())
+    enem = nullptr;
   if(enem!=nullptr){
     float dist=qDistTo(*enem);
     if(perceptionProcess(*enem,nullptr,dist,PERC_ASSESSENEMY)){
@@ -2749,7 +2809,8 @@ bool Npc::perceptionProcess(Npc &pl) {
       }
     }
 
-  Npc* body=hasPerc(PERC_ASSESSBODY) ? updateNearestBody() : nullptr;
+  Npc* body=hasPerc(PERC_ASSESSBODY) ? percBody : nullptr;
+  percBody = nullptr;
   if(body!=nullptr){
     float dist=qDistTo(*body);
     if(perceptionProcess(*body,nullptr,dist,PERC_ASSESSBODY)) {
@@ -3260,36 +3321,101 @@ SensesBit Npc::canSenseNpc(const Npc &oth, bool freeLos, float extRange) const {
   }
 
 SensesBit Npc::canSenseNpc(float tx, float ty, float tz, bool freeLos, bool isNoisy, float extRange) const {
-  DynamicWorld* w = owner.physic();
   static const double ref = std::cos(100*M_PI/180.0); // spec requires +-100 view angle range
 
-  const float range = float(hnpc.senses_range)+extRange;
-  if(qDistTo(tx,ty,tz)>range*range)
+  bool      inRange = false;
+  SensesBit ret     = implSense(tx,ty,tz,isNoisy,extRange,inRange);
+  if(!inRange)
     return SensesBit::SENSE_NONE;
 
-  SensesBit ret=SensesBit::SENSE_NONE;
-  if(owner.roomAt({tx,ty,tz})==owner.roomAt({x,y,z})) {
-    ret = ret | SensesBit::SENSE_SMELL;
-    if(isNoisy)
-      ret = ret | SensesBit::SENSE_HEAR;
-    }
-
   if(!freeLos){
     float dx  = x-tx, dz=z-tz;
     float dir = angleDir(dx,dz);
     float da  = float(M_PI)*(visual.viewDirection()-dir)/180.f;
     if(double(std::cos(da))<=ref)
-      if(!w->ray(x,y+180,z, tx,ty,tz).hasCol)
+      if(implLos({tx,ty,tz}))
         ret = ret | SensesBit::SENSE_SEE;
     } else {
     // TODO: npc eyesight height
-    if(!w->ray(x,y+180,z, tx,ty,tz).hasCol)
+    if(implLos({tx,ty,tz}))
       ret = ret | SensesBit::SENSE_SEE;
     }
   return ret & SensesBit(hnpc.senses);
   }
 
-void Npc::updatePos() {
+SensesBit Npc::canSenseNpcNoLos(const Npc& oth, float extRange, bool& needLos) const {
+  // same as canSenseNpc with free los, but ray test is left to caller
+  const bool isNoisy = (oth.bodyState()&BodyState::BS_SNEAK)==0;
+  bool       inRange = false;
+  SensesBit  ret     = implSense(oth.x,oth.y+180,oth.z,isNoisy,extRange,inRange) & SensesBit(hnpc.senses);
+
+  needLos = inRange && ret==SensesBit::SENSE_NONE &&
+            (SensesBit(hnpc.senses)&SensesBit::SENSE_SEE)!=SensesBit::SENSE_NONE;
+  return ret;
+  }
+
+SensesBit Npc::implSense(float tx, float ty, float tz, bool isNoisy, float extRange, bool& inRange) const {
+  const float range = float(hnpc.senses_range)+extRange;
+  inRange = qDistTo(tx,ty,tz)<=range*range;
+  if(!inRange)
+    return SensesBit::SENSE_NONE;
+
+  SensesBit ret=SensesBit::SENSE_NONE;
+  if(owner.roomAt({tx,ty,tz})==owner.roomAt({x,y,z})) {
+    ret = ret | SensesBit::SENSE_SMELL;
+    if(isNoisy)
+      ret = ret | SensesBit::SENSE_HEAR;
+    }
+  return ret;
+  }
+
+bool Npc::implLos(const Vec3& to) const {
+  // same pair is tested many times per frame by scripts - reuse result, while nothing moved much
+  static const float    maxMove = 5.f;
+  static const uint64_t maxAge  = 500;
+
+  const Vec3     from = {x,y+180,z};
+  const uint64_t now  = owner.tickCount();
+  for(auto& i:losCache) {
+    if(i.time==0 || i.time+maxAge<now)
+      continue;
+    if((i.from-from).quadLength()<maxMove*maxMove && (i.to-to).quadLength()<maxMove*maxMove)
+      return i.visible;
+    }
+
+  auto& c   = losCache[losCacheNext];
+  c.from    = from;
+  c.to      = to;
+  c.time    = std::max<uint64_t>(now,1);
+  c.visible = !owner.physic()->ray(from.x,from.y,from.z, to.x,to.y,to.z).hasCol;
+  losCacheNext = uint8_t((losCacheNext+1)%LosCacheSize);
+  return c.visible;
+  }
+
+Tempest::Vec3 Npc::renderPosition() const {
+  const auto cur = position();
+  const auto d   = cur-simPrev;
+  if(d.quadLength()>500.f*500.f)
+    return cur; // teleport
+  return simPrev + d*owner.interpolation();
+  }
+
+float Npc::renderRotation() const {
+  if((position()-simPrev).quadLength()>500.f*500.f)
+    return angle; // teleport
+  // shortest arc between previous and current step
+  float d = std::fmod(angle-simPrevAngle,360.f);
+  if(d>180.f)
+    d -= 360.f;
+  if(d<-180.f)
+    d += 360.f;
+  return simPrevAngle + d*owner.interpolation();
+  }
+
+void Npc::updatePos(const Tempest::Vec3& at, float rot) {
+  drawPos   = at;
+  drawAngle = rot;
+
   auto gl    = guild();
   bool align = (world().script().guildVal().surface_align[gl]!=0) || isDead();
 
@@ -3308,7 +3434,7 @@ void Npc::updatePos() {
     }
 
   if(durtyTranform==TR_Pos){
-    visual.setPos(x,y,z);
+    visual.setPos(at.x,at.y,at.z);
     } else {
     Matrix4x4 mt;
     if(align) {
@@ -3319,7 +3445,7 @@ void Npc::updatePos() {
          ox.x, ox.y, ox.z, 0,
          oy.x, oy.y, oy.z, 0,
         -oz.x,-oz.y,-oz.z, 0,
-            x,    y,    z, 1
+         at.x, at.y, at.z, 1
       };
       mt = Matrix4x4(v);
       } else {
@@ -3327,12 +3453,12 @@ void Npc::updatePos() {
         1, 0, 0, 0,
         0, 1, 0, 0,
         0, 0, 1, 0,
-        x, y, z, 1
+        at.x, at.y, at.z, 1
       };
       mt = Matrix4x4(v);
       }
 
-    mt.rotateOY(180-angle);
+    mt.rotateOY(180-rot);
     if(mvAlgo.isDive())
       mt.rotateOX(-angleY);
     if(isPlayer() && !align) {
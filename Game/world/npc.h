@@ -12,6 +12,7 @@
 #include "game/gamescript.h"
 #include "physics/dynamicworld.h"
 #include "fplock.h"
+#include "handletable.h"
 #include "waypath.h"
 
 #include <cstdint>
@@ -185,7 +186,10 @@ class Npc final {
     bool       isPlayer() const;
     void       setWalkMode(WalkBit m);
     auto       walkMode() const { return wlkMode; }
+    void       tickAnimation();
     void       tick(uint64_t dt);
+    void       skipTick(uint64_t dt);
+    uint64_t   skippedTime() const   { return tickSkip; }
     bool       startClimb(JumpCode code);
 
     auto       world() -> World&;
@@ -209,6 +213,8 @@ class Npc final {
 
     void       updateAnimation();
     void       updateTransform();
+    void       storeSimPosition() { simPrev = position(); simPrevAngle = angle; }
+    float      renderRotation() const;
 
     const char*displayName() const;
     auto       displayPosition() const -> Tempest::Vec3;
@@ -337,6 +343,7 @@ class Npc final {
     void      setPerceptionEnable (PercType t, size_t fn);
     void      setPerceptionDisable(PercType t);
 
+    void      perceptionSense(const Npc& pl);
     bool      perceptionProcess(Npc& pl);
     bool      perceptionProcess(Npc& pl, Npc *victum, float quadDist, PercType perc);
     bool      hasPerc(PercType perc) const;
@@ -367,6 +374,8 @@ class Npc final {
     auto      dialogChoises(Npc &player, const std::vector<uint32_t> &except, bool includeImp) -> std::vector<GameScript::DlgChoise>;
 
     auto      handle() -> Daedalus::GEngineClasses::C_Npc* { return  &hnpc; }
+    ObjHandle objHandle() const { return hObj; }
+    void      setObjHandle(ObjHandle h) { hObj = h; }
 
     auto      inventory() const -> const Inventory& { return invent; }
     size_t    hasItem    (size_t id) const;
@@ -446,6 +455,7 @@ class Npc final {
     bool      canSeeNpc(float x,float y,float z,bool freeLos) const;
     auto      canSenseNpc(const Npc& oth,bool freeLos, float extRange=0.f) const -> SensesBit;
     auto      canSenseNpc(float x,float y,float z,bool freeLos,bool isNoisy,float extRange=0.f) const -> SensesBit;
+    auto      canSenseNpcNoLos(const Npc& oth, float extRange, bool& needLos) const -> SensesBit;
 
     void      setTarget(Npc* t);
     Npc*      target() const;
@@ -551,6 +561,14 @@ class Npc final {
       ScriptFn func;
       };
 
+    enum { LosCacheSize = 8 };
+
+    struct LosCache final {
+      Tempest::Vec3    from, to;
+      uint64_t         time    = 0;
+      bool             visible = false;
+      };
+
     struct GoTo final {
       GoToHint         flag = GoToHint::GT_No;
       Npc*             npc  = nullptr;
@@ -567,8 +585,12 @@ class Npc final {
 
     void      updateWeaponSkeleton();
     void      tickTimedEvt(Animation::EvCount &ev);
+    auto      implSense(float x,float y,float z,bool isNoisy,float extRange,bool& inRange) const -> SensesBit;
+    bool      implLos(const Tempest::Vec3& to) const;
     void      tickRegen(int32_t& v,const int32_t max,const int32_t chg, const uint64_t dt);
-    void      updatePos();
+    void      tickMove(uint64_t dt);
+    void      updatePos(const Tempest::Vec3& at, float rot);
+    auto      renderPosition() const -> Tempest::Vec3;
     bool      setViewPosition(const Tempest::Vec3& pos);
 
     int       aiOutputOrderId() const;
@@ -614,6 +636,7 @@ class Npc final {
 
     World&                         owner;
     Daedalus::GEngineClasses::C_Npc hnpc={};
+    ObjHandle                      hObj;
     float                          x=0.f;
     float                          y=0.f;
     float                          z=0.f;
@@ -626,6 +649,10 @@ class Npc final {
     // visual props (cache)
     uint8_t                        durtyTranform=0;
     Tempest::Vec3                  groundNormal;
+    Tempest::Vec3                  simPrev;
+    float                          simPrevAngle = 0.f;
+    Tempest::Vec3                  drawPos;
+    float                          drawAngle    = 0.f;
 
     // visual props
     std::string                    body,head;
@@ -680,6 +707,11 @@ class Npc final {
     Tempest::Vec3                  moveMobCacheKey={std::numeric_limits<float>::infinity(),0.f,0.f};
     Interactive*                   moveMob        =nullptr;
 
+    // sensed in parallel phase, consumed by perceptionProcess
+    bool                           percSensed     =false;
+    SensesBit                      percSensePl    =SensesBit::SENSE_NONE;
+    Npc*                           percBody       =nullptr;
+
     GoTo                           go2;
     const WayPoint*                currentFp      =nullptr;
     FpLock                         currentFpLock;
@@ -688,6 +720,12 @@ class Npc final {
     MoveAlgo                       mvAlgo;
     FightAlgo                      fghAlgo;
     uint64_t                       lastEventTime=0;
+    Animation::EvCount             tickEv;
+    bool                           tickEvReady=false;
+    uint64_t                       tickSkip=0;
+
+    mutable LosCache               losCache[LosCacheSize];
+    mutable uint8_t                losCacheNext=0;
 
   friend class MoveAlgo;
   };
@@ -61,6 +61,11 @@ void StaticObj::moveEvent() {
   visual.setPos(transform());
   }
 
+void StaticObj::renderEvent(const Tempest::Matrix4x4& tr) {
+  pfx   .setObjMatrix(tr);
+  visual.setPos(tr);
+  }
+
 bool StaticObj::setMobState(const char* sc, int32_t st) {
   const bool ret = Vob::setMobState(sc,st);
 
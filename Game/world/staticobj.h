@@ -12,6 +12,7 @@ class StaticObj : public Vob {
 
   private:
     void  moveEvent() override;
+    void  renderEvent(const Tempest::Matrix4x4& tr) override;
     bool  setMobState(const char* scheme,int32_t st) override;
 
     PhysicMesh                 physic;
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+// Hierarchical timer wheel over world ticks (milliseconds).
+// Level 0 has one slot per tick, each next level is Slots times coarser;
+// entries cascade down as time reaches their slot. Cost per advance is O(fired).
+template<class T>
+class TimerWheel final {
+  public:
+    TimerWheel()=default;
+
+    size_t size() const { return count+ready.size(); }
+
+    void clear() {
+      for(auto& l:wheel)
+        for(auto& s:l)
+          s.clear();
+      for(auto& c:levelCnt)
+        c = 0;
+      ready.clear();
+      count = 0;
+      cur   = 0;
+      }
+
+    void insert(uint64_t time, T&& v) {
+      Entry e;
+      e.time = time;
+      e.val  = std::move(v);
+      if(time<=cur)
+        ready.emplace_back(std::move(e)); else
+        place(std::move(e));
+      }
+
+    // call f for every entry with time<=now; f may insert new entries
+    template<class F>
+    void advance(uint64_t now, F f) {
+      if(ready.size()>0) {
+        std::vector<Entry> rd;
+        std::swap(rd,ready);
+        for(auto& i:rd)
+          f(i.val);
+        }
+
+      while(cur<now) {
+        if(count==0) {
+          cur = now;
+          break;
+          }
+
+        // skip ticks, while lower levels are empty
+        uint64_t mask = 0;
+        for(size_t l=0; l<Levels && levelCnt[l]==0; ++l)
+          mask = (mask<<SlotBits) | (Slots-1);
+        if(mask!=0) {
+          const uint64_t next = cur|mask;
+          if(next>=now) {
+            cur = now;
+            break;
+            }
+          cur = next;
+          }
+
+        ++cur;
+        for(size_t l=Levels-1; l>0; --l)
+          if((cur & ((uint64_t(1)<<(SlotBits*l))-1))==0)
+            cascade(l);
+
+        auto& s = wheel[0][cur & (Slots-1)];
+        if(s.size()==0)
+          continue;
+        std::vector<Entry> due;
+        std::swap(due,s);
+        count       -= due.size();
+        levelCnt[0] -= due.size();
+        for(auto& i:due)
+          f(i.val);
+        }
+      }
+
+    template<class F>
+    void forEach(F f) const {
+      for(auto& i:ready)
+        f(i.val);
+      for(auto& l:wheel)
+        for(auto& s:l)
+          for(auto& i:s)
+            f(i.val);
+      }
+
+  private:
+    enum : uint32_t {
+      SlotBits = 6,
+      Slots    = 1u<<SlotBits,
+      Levels   = 4,
+      };
+
+    struct Entry final {
+      uint64_t time = 0;
+      T        val;
+      };
+
+    std::vector<Entry> wheel[Levels][Slots];
+    size_t             levelCnt[Levels] = {};
+    std::vector<Entry> ready;
+    size_t             count = 0;
+    uint64_t           cur   = 0;
+
+    void place(Entry&& e) {
+      // lowest level, where time shares all higher digits with cur
+      size_t l = 0;
+      while(l+1<Levels && (e.time>>(SlotBits*(l+1)))!=(cur>>(SlotBits*(l+1))))
+        ++l;
+      auto& s = wheel[l][(e.time>>(SlotBits*l)) & (Slots-1)];
+      s.emplace_back(std::move(e));
+      levelCnt[l]++;
+      count++;
+      }
+
+    void cascade(size_t l) {
+      auto& s = wheel[l][(cur>>(SlotBits*l)) & (Slots-1)];
+      if(s.size()==0)
+        return;
+      std::vector<Entry> mv;
+      std::swap(mv,s);
+      count       -= mv.size();
+      levelCnt[l] -= mv.size();
+      for(auto& i:mv)
+        place(std::move(i));
+      }
+  };
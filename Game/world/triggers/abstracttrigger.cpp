@@ -152,6 +152,12 @@ bool AbstractTrigger::checkPos(float x,float y,float z) const {
   return false;
   }
 
+void AbstractTrigger::volumeBounds(Vec3& min, Vec3& max) const {
+  auto cen = position() + bboxOrigin;
+  min = cen - bboxSize;
+  max = cen + bboxSize;
+  }
+
 void AbstractTrigger::save(Serialize& fout) const {
   Vob::save(fout);
   fout.write(uint32_t(intersect.size()));
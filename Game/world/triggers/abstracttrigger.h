@@ -52,6 +52,7 @@ class AbstractTrigger : public Vob {
 
     virtual bool                 hasVolume() const;
     virtual bool                 checkPos(float x,float y,float z) const;
+    void                         volumeBounds(Tempest::Vec3& min, Tempest::Vec3& max) const;
 
     void                         save(Serialize& fout) const override;
     void                         load(Serialize &fin) override;
@@ -25,6 +25,10 @@ MoveTrigger::MoveTrigger(Vob* parent, World& world, ZenLoad::zCVobData&& d, bool
   pos0 = localTransform();
   pos0.mul(tr);
 
+  if(frame<data.zCMover.keyframes.size()) {
+    frCur = data.zCMover.keyframes[frame];
+    hasFr = true;
+    }
   moveEvent();
   }
 
@@ -38,6 +42,10 @@ void MoveTrigger::load(Serialize& fin) {
     return;
   AbstractTrigger::load(fin);
   fin.read(pos0,reinterpret_cast<uint8_t&>(state),sAnim,frame);
+  hasFr  = (state==Idle && frame<data.zCMover.keyframes.size());
+  frTick = 0;
+  if(hasFr)
+    frCur = data.zCMover.keyframes[frame];
   moveEvent();
   if(state!=Idle)
     enableTicks();
@@ -61,15 +69,38 @@ void MoveTrigger::advanceAnim(uint32_t f0, uint32_t f1, float alpha) {
   auto fr  = mix(data.zCMover.keyframes[f0],data.zCMover.keyframes[f1],alpha);
   auto mat = pos0;
   mat.mul(mkMatrix(fr));
+
+  frPrev = hasFr ? frCur : fr;
+  frCur  = fr;
+  hasFr  = true;
+  frTick = world.tickCount();
   setLocalTransform(mat);
   }
 
+void MoveTrigger::updateAnimation() {
+  if(frTick==0)
+    return;
+  if(frTick!=world.tickCount()) {
+    // stopped at previous step - snap to final position
+    frTick = 0;
+    setLocalRenderTransform(localTransform());
+    return;
+    }
+  auto mat = pos0;
+  mat.mul(mkMatrix(mix(frPrev,frCur,world.interpolation())));
+  setLocalRenderTransform(mat);
+  }
+
 void MoveTrigger::moveEvent() {
   Vob::moveEvent();
   view  .setObjMatrix(transform());
   physic.setObjMatrix(transform());
   }
 
+void MoveTrigger::renderEvent(const Tempest::Matrix4x4& tr) {
+  view.setObjMatrix(tr);
+  }
+
 void MoveTrigger::onTrigger(const TriggerEvent& e) {
   processTrigger(e,true);
   }
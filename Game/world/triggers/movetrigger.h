@@ -16,9 +16,11 @@ class MoveTrigger : public AbstractTrigger {
 
     bool hasVolume() const override;
     void tick(uint64_t dt) override;
+    void updateAnimation();
 
   private:
     void moveEvent() override;
+    void renderEvent(const Tempest::Matrix4x4& tr) override;
     void processTrigger(const TriggerEvent& evt, bool onTrigger);
 
     void setView     (MeshObjects::Mesh&& m);
@@ -42,4 +44,9 @@ class MoveTrigger : public AbstractTrigger {
     uint64_t                 sAnim     = 0;
 
     uint32_t                 frame     = 0;
+
+    // samples of two last simulation steps, blended for rendering
+    ZenLoad::zCModelAniSample frPrev, frCur;
+    bool                     hasFr     = false;
+    uint64_t                 frTick    = 0;
   };
@@ -55,6 +55,10 @@ void PfxController::moveEvent() {
   pfx.setObjMatrix(transform());
   }
 
+void PfxController::renderEvent(const Tempest::Matrix4x4& tr) {
+  pfx.setObjMatrix(tr);
+  }
+
 void PfxController::tick(uint64_t /*dt*/) {
   if(killed<world.tickCount()) {
     disableTicks();
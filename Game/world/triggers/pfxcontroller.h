@@ -16,6 +16,7 @@ class PfxController : public AbstractTrigger {
     void onTrigger(const TriggerEvent& evt) override;
     void onUntrigger(const TriggerEvent& evt) override;
     void moveEvent() override;
+    void renderEvent(const Tempest::Matrix4x4& tr) override;
     void tick(uint64_t dt) override;
 
     PfxObjects::Emitter pfx;
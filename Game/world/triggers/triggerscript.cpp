@@ -5,11 +5,16 @@
 
 TriggerScript::TriggerScript(Vob* parent, World &world, ZenLoad::zCVobData&& data, bool startup)
   :AbstractTrigger(parent,world,std::move(data),startup) {
+  scriptFn = world.getSymbolIndex(this->data.zCTriggerScript.scriptFunc.c_str());
   }
 
 void TriggerScript::onTrigger(const TriggerEvent &) {
+  if(scriptFn==size_t(-1)) {
+    Tempest::Log::e("exception in trigger-script: script bad call");
+    return;
+    }
   try {
-    world.script().runFunction(data.zCTriggerScript.scriptFunc.c_str());
+    world.script().runFunction(scriptFn);
     }
   catch(std::runtime_error& e){
     Tempest::Log::e("exception in trigger-script: ",e.what());
@@ -75,6 +75,14 @@ void Vob::setLocalTransform(const Matrix4x4& p) {
   recalculateTransform();
   }
 
+bool Vob::isDynamic() const {
+  // attached to a mover, directly or through a parent
+  for(auto p=this; p!=nullptr; p=p->parent)
+    if(p->vobType==ZenLoad::zCVobData::VT_zCMover)
+      return true;
+  return false;
+  }
+
 bool Vob::setMobState(const char* scheme, int32_t st) {
   bool ret = true;
   for(auto& i:child)
@@ -85,6 +93,29 @@ bool Vob::setMobState(const char* scheme, int32_t st) {
 void Vob::moveEvent() {
   }
 
+void Vob::renderEvent(const Matrix4x4&) {
+  }
+
+void Vob::setLocalRenderTransform(const Matrix4x4& p) {
+  // visual-only transform, simulation state (transform(), physics) is unchanged
+  if(parent!=nullptr) {
+    auto tr = parent->transform();
+    tr.mul(p);
+    implRenderTransform(tr);
+    } else {
+    implRenderTransform(p);
+    }
+  }
+
+void Vob::implRenderTransform(const Matrix4x4& tr) {
+  renderEvent(tr);
+  for(auto& i:child) {
+    auto m = tr;
+    m.mul(i->local);
+    i->implRenderTransform(m);
+    }
+  }
+
 void Vob::recalculateTransform() {
   auto old = position();
   if(parent!=nullptr) {
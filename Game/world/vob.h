@@ -28,11 +28,14 @@ class Vob {
     auto          localTransform() const -> const Tempest::Matrix4x4& { return local; }
     void          setLocalTransform(const Tempest::Matrix4x4& p);
     virtual bool  setMobState(const char* scheme, int32_t st);
+    bool          isDynamic() const;
 
   protected:
     World&                            world;
 
     virtual void  moveEvent();
+    virtual void  renderEvent(const Tempest::Matrix4x4& tr);
+    void          setLocalRenderTransform(const Tempest::Matrix4x4& p);
 
   private:
     enum ContentBit : uint8_t {
@@ -48,5 +51,6 @@ class Vob {
     Vob*                              parent = nullptr;
 
     void          recalculateTransform();
+    void          implRenderTransform(const Tempest::Matrix4x4& tr);
   };
 
@@ -3,12 +3,72 @@
 #include <Tempest/Log>
 #include <algorithm>
 #include <limits>
+#include <cmath>
 
 #include "world.h"
 #include "utils/gthfont.h"
 
 using namespace Tempest;
 
+static const uint32_t NoRegion      = uint32_t(-1);
+static const float    RegionSize    = 4000.f;         // size of hierarchy cell, 40 meters
+static const float    HierarchyDist = 2.f*RegionSize; // min distance to use coarse search
+
+struct WayMatrix::PathScratch final {
+  struct Node final {
+    size_t  id   =0;
+    int32_t len  =0;
+    int32_t score=0;
+    };
+
+  std::vector<int32_t>  len;
+  std::vector<size_t>   parent;
+  std::vector<uint32_t> gen;
+  std::vector<Node>     heap;
+  uint32_t              pathGen=0;
+
+  void begin(size_t count) {
+    if(gen.size()<count) {
+      len   .resize(count);
+      parent.resize(count);
+      gen   .resize(count,0);
+      }
+    heap.clear();
+    pathGen++;
+    if(pathGen==0) {
+      // new cycle
+      std::fill(gen.begin(),gen.end(),0);
+      pathGen = 1;
+      }
+    }
+
+  bool isVisited(size_t id) const {
+    return gen[id]==pathGen;
+    }
+
+  void visit(size_t id, int32_t l, size_t from) {
+    gen   [id] = pathGen;
+    len   [id] = l;
+    parent[id] = from;
+    }
+
+  void push(size_t id, int32_t l, int32_t score) {
+    heap.push_back(Node{id,l,score});
+    std::push_heap(heap.begin(),heap.end(),cmp);
+    }
+
+  Node pop() {
+    std::pop_heap(heap.begin(),heap.end(),cmp);
+    auto ret = heap.back();
+    heap.pop_back();
+    return ret;
+    }
+
+  static bool cmp(const Node& a, const Node& b) {
+    return a.score>b.score;
+    }
+  };
+
 WayMatrix::WayMatrix(World &world, const ZenLoad::zCWayNetData &dat)
   :world(world) {
   wayPoints.resize(dat.waypoints.size());
@@ -25,12 +85,10 @@ WayMatrix::WayMatrix(World &world, const ZenLoad::zCWayNetData &dat)
   for(auto& i:wayPoints)
     if(i.name.find("START")!=std::string::npos)
       startPoints.push_back(i);
-
-  stk[0].reserve(256);
-  stk[1].reserve(256);
   }
 
 void WayMatrix::buildIndex() {
+  invalidatePathCache();
   indexPoints.clear();
   adjustWaypoints(wayPoints);
   adjustWaypoints(freePoints);
@@ -54,6 +112,7 @@ void WayMatrix::buildIndex() {
       b.connect(a);
       }
     }
+  buildHierarchy();
   }
 
 const WayPoint *WayMatrix::findWayPoint(float x, float y, float z) const {
@@ -248,8 +307,9 @@ WayPath WayMatrix::wayTo(float npcX, float npcY, float npcZ, const WayPoint &end
   }
 
 WayPath WayMatrix::wayTo(const WayPoint& start, const WayPoint &end) const {
-  intptr_t endId = std::distance<const WayPoint*>(&wayPoints[0],&end);
-  if(endId<0 || size_t(endId)>=wayPoints.size()){
+  const size_t endId   = pointId(end);
+  const size_t startId = pointId(start);
+  if(endId>=wayPoints.size()){
     if(end.name.find("FP_")==0) {
       WayPath ret;
       ret.add(end);
@@ -257,58 +317,261 @@ WayPath WayMatrix::wayTo(const WayPoint& start, const WayPoint &end) const {
       }
     return WayPath();
     }
+  if(startId>=wayPoints.size())
+    return WayPath();
+
+  const uint64_t key = (uint64_t(startId)<<32) | uint64_t(endId);
+  {
+    std::lock_guard<std::mutex> guard(pathCacheSync);
+    auto it = pathCacheIndex.find(key);
+    if(it!=pathCacheIndex.end()) {
+      pathCache.splice(pathCache.begin(),pathCache,it->second);
+      return WayPath(it->second->path);
+      }
+  }
+
+  auto path = findPath(startId,endId);
+
+  std::lock_guard<std::mutex> guard(pathCacheSync);
+  if(pathCacheIndex.find(key)==pathCacheIndex.end()) {
+    pathCache.push_front(CachedPath{key,path});
+    pathCacheIndex[key] = pathCache.begin();
+    if(pathCache.size()>PathCacheSize) {
+      pathCacheIndex.erase(pathCache.back().key);
+      pathCache.pop_back();
+      }
+    }
+  return WayPath(std::move(path));
+  }
+
+std::shared_ptr<const WayPath::Points> WayMatrix::findPath(size_t startId, size_t endId) const {
+  auto& a = wayPoints[startId];
+  auto& b = wayPoints[endId];
+  if(wpRegion[startId]!=wpRegion[endId] &&
+     a.qDistTo(b.x,b.y,b.z)>HierarchyDist*HierarchyDist) {
+    if(auto ret = findPathHierarchical(startId,endId))
+      return ret;
+    }
+
+  // search state is per-thread, so path queries can run concurrently
+  thread_local PathScratch scratch;
+  if(!search(scratch,startId,endId,NoRegion))
+    return nullptr;
+
+  auto ret = std::make_shared<WayPath::Points>();
+  for(size_t id=endId; ; id=scratch.parent[id]) {
+    ret->push_back(&wayPoints[id]);
+    if(id==startId)
+      break;
+    }
+  return ret;
+  }
+
+std::shared_ptr<const WayPath::Points> WayMatrix::findPathHierarchical(size_t startId, size_t endId) const {
+  thread_local PathScratch           coarse, local;
+  thread_local std::vector<PortalEdge> startEdges, endEdges;
+  thread_local std::vector<size_t>   route;
+
+  // entry costs: from start to portals of it's region, and from portals to end
+  regionCosts(local,startId,startEdges);
+  regionCosts(local,endId,  endEdges);
+  if(startEdges.empty() || endEdges.empty())
+    return nullptr;
+
+  const WayPoint& end = wayPoints[endId];
+  auto heuristic = [&end](const WayPoint& w) {
+    return int32_t(std::sqrt(w.qDistTo(end.x,end.y,end.z)));
+    };
+
+  auto& s = coarse;
+  s.begin(wayPoints.size());
+  s.visit(startId,0,startId);
+  s.push(startId,0,heuristic(wayPoints[startId]));
+
+  auto relax = [&](size_t from, int32_t len, const PortalEdge& e) {
+    const int32_t l1 = len+e.len;
+    if(s.isVisited(e.to) && s.len[e.to]<=l1)
+      return;
+    s.visit(e.to,l1,from);
+    s.push(e.to,l1,l1+heuristic(wayPoints[e.to]));
+    };
+
+  bool found = false;
+  while(s.heap.size()>0) {
+    auto node = s.pop();
+    if(node.len!=s.len[node.id])
+      continue;
+    if(node.id==endId) {
+      found = true;
+      break;
+      }
+
+    if(node.id==startId) {
+      for(auto& e:startEdges)
+        relax(node.id,node.len,e);
+      }
+    for(auto& e:portalEdges[node.id])
+      relax(node.id,node.len,e);
+    if(wpRegion[node.id]==wpRegion[endId]) {
+      for(auto& e:endEdges)
+        if(e.to==node.id)
+          relax(node.id,node.len,PortalEdge{endId,e.len});
+      }
+    }
 
-  pathGen++;
-  if(pathGen==1){
-    // new cycle
-    for(auto& i:wayPoints)
-      i.pathGen=0;
+  if(!found)
+    return nullptr;
+
+  route.clear();
+  for(size_t id=endId; ; id=s.parent[id]) {
+    route.push_back(id);
+    if(id==startId)
+      break;
     }
-  start.pathLen = 0;
-  start.pathGen = pathGen;
-
-  std::vector<const WayPoint*> *front=&stk[0], *back=&stk[1];
-  stk[0].clear();
-  stk[1].clear();
-
-  front->push_back(&start);
-
-  while(end.pathGen!=pathGen && front->size()>0){
-    for(auto& wp:*front){
-      int32_t l0 = wp->pathLen;
-
-      for(auto i:wp->connections()){
-        auto& w  = *i.point;
-        int32_t l1 = l0+i.len;
-        if(w.pathGen!=pathGen || w.pathLen>l1){
-          w.pathLen = l1;
-          w.pathGen = pathGen;
-          back->push_back(&w);
-          }
+
+  // refine: coarse route is end->start; expand every intra-region step
+  auto ret = std::make_shared<WayPath::Points>();
+  ret->push_back(&wayPoints[endId]);
+  for(size_t i=0; i+1<route.size(); ++i) {
+    const size_t to   = route[i];
+    const size_t from = route[i+1];
+    if(wpRegion[to]!=wpRegion[from]) {
+      // portal edge - direct connection
+      ret->push_back(&wayPoints[from]);
+      continue;
+      }
+    if(!search(local,from,to,wpRegion[from]))
+      return nullptr;
+    for(size_t id=local.parent[to]; ; id=local.parent[id]) {
+      ret->push_back(&wayPoints[id]);
+      if(id==from)
+        break;
+      }
+    }
+  return ret;
+  }
+
+bool WayMatrix::search(PathScratch& s, size_t startId, size_t endId, uint32_t region) const {
+  s.begin(wayPoints.size());
+
+  const bool      hasEnd = endId<wayPoints.size();
+  const WayPoint& end    = wayPoints[hasEnd ? endId : startId];
+  auto heuristic = [&end,hasEnd](const WayPoint& w) {
+    if(!hasEnd)
+      return 0;
+    return int32_t(std::sqrt(w.qDistTo(end.x,end.y,end.z)));
+    };
+
+  s.visit(startId,0,startId);
+  s.push(startId,0,heuristic(wayPoints[startId]));
+
+  while(s.heap.size()>0) {
+    auto node = s.pop();
+    if(node.len!=s.len[node.id])
+      continue; // stale heap entry
+    if(node.id==endId)
+      return true;
+
+    for(auto i:wayPoints[node.id].connections()){
+      const size_t  id = pointId(*i.point);
+      const int32_t l1 = node.len+i.len;
+      if(id>=wayPoints.size())
+        continue;
+      if(region!=NoRegion && wpRegion[id]!=region)
+        continue;
+      if(s.isVisited(id) && s.len[id]<=l1)
+        continue;
+      s.visit(id,l1,node.id);
+      s.push(id,l1,l1+heuristic(*i.point));
+      }
+    }
+  return !hasEnd;
+  }
+
+void WayMatrix::regionCosts(PathScratch& s, size_t from, std::vector<PortalEdge>& out) const {
+  out.clear();
+  const uint32_t region = wpRegion[from];
+  search(s,from,size_t(-1),region);
+  for(auto id:regionPortals[region]) {
+    if(s.isVisited(id))
+      out.push_back(PortalEdge{id,s.len[id]});
+    }
+  }
+
+void WayMatrix::buildHierarchy() {
+  // level 0: waypoints; level 1: regions - connected clusters of waypoints in a coarse xz-grid
+  wpRegion.assign(wayPoints.size(),NoRegion);
+  regionPortals.clear();
+  portalEdges.clear();
+  portalEdges.resize(wayPoints.size());
+
+  auto cellOf = [](const WayPoint& w) {
+    auto x = int32_t(std::floor(w.x/RegionSize));
+    auto z = int32_t(std::floor(w.z/RegionSize));
+    return (uint64_t(uint32_t(x))<<32) | uint64_t(uint32_t(z));
+    };
+
+  std::vector<size_t> stk;
+  uint32_t            regionCount = 0;
+  for(size_t i=0; i<wayPoints.size(); ++i) {
+    if(wpRegion[i]!=NoRegion)
+      continue;
+    const uint64_t cell = cellOf(wayPoints[i]);
+    wpRegion[i] = regionCount;
+    stk.push_back(i);
+    while(stk.size()>0) {
+      auto& w = wayPoints[stk.back()];
+      stk.pop_back();
+      for(auto& c:w.connections()) {
+        size_t id = pointId(*c.point);
+        if(id>=wayPoints.size() || wpRegion[id]!=NoRegion || cellOf(*c.point)!=cell)
+          continue;
+        wpRegion[id] = regionCount;
+        stk.push_back(id);
         }
       }
-    std::swap(front,back);
-    back->clear();
+    regionCount++;
     }
 
-  WayPath ret;
-  ret.add(end);
-  const WayPoint* current = &end;
-  while(current!=&start){
-    int32_t l0 = current->pathLen, l1=l0;
-
-    const WayPoint* next=nullptr;
-    for(auto i:current->connections()){
-      if(i.point->pathGen==pathGen && i.point->pathLen+i.len<=l0 && i.point->pathLen<l1){
-        next = i.point;
-        l1   = i.point->pathLen;
+  // portals: waypoints with connections into another region
+  regionPortals.resize(regionCount);
+  for(size_t i=0; i<wayPoints.size(); ++i) {
+    bool portal = false;
+    for(auto& c:wayPoints[i].connections()) {
+      size_t id = pointId(*c.point);
+      if(id<wayPoints.size() && wpRegion[id]!=wpRegion[i]) {
+        portalEdges[i].push_back(PortalEdge{id,c.len});
+        portal = true;
         }
       }
-    if(next==nullptr)
-      return WayPath();
-    ret.add(*next);
-    current=next;
+    if(portal)
+      regionPortals[wpRegion[i]].push_back(i);
     }
 
-  return ret;
+  // cached intra-region costs between portals
+  PathScratch               s;
+  std::vector<PortalEdge>   cost;
+  for(auto& portals:regionPortals) {
+    for(auto id:portals) {
+      regionCosts(s,id,cost);
+      for(auto& e:cost)
+        if(e.to!=id)
+          portalEdges[id].push_back(e);
+      }
+    }
+  }
+
+size_t WayMatrix::pointId(const WayPoint& p) const {
+  if(wayPoints.empty())
+    return size_t(-1);
+  intptr_t id = std::distance<const WayPoint*>(&wayPoints[0],&p);
+  if(id<0 || size_t(id)>=wayPoints.size())
+    return size_t(-1);
+  return size_t(id);
+  }
+
+void WayMatrix::invalidatePathCache() {
+  std::lock_guard<std::mutex> guard(pathCacheSync);
+  pathCache.clear();
+  pathCacheIndex.clear();
   }
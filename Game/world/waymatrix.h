@@ -5,6 +5,9 @@
 
 #include <zenload/zTypes.h>
 #include <vector>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 
 #include "waypath.h"
 #include "waypoint.h"
@@ -34,6 +37,8 @@ class WayMatrix final {
     WayPath         wayTo(float npcX,float npcY,float npcZ,const WayPoint& end) const;
 
   private:
+    enum { PathCacheSize=512 };
+
     World&                 world;
     using Edge = std::pair<size_t,size_t>;
     std::vector<Edge>      edges;
@@ -50,11 +55,33 @@ class WayMatrix final {
       };
     mutable std::vector<FpIndex>          fpIndex;
 
-    mutable uint16_t                      pathGen=0;
-    mutable std::vector<const WayPoint*>  stk[2];
+    struct PathScratch;
+
+    struct PortalEdge {
+      size_t  to =0;
+      int32_t len=0;
+      };
+    std::vector<uint32_t>                 wpRegion;
+    std::vector<std::vector<size_t>>      regionPortals;
+    std::vector<std::vector<PortalEdge>>  portalEdges;
+
+    struct CachedPath {
+      uint64_t                               key=0;
+      std::shared_ptr<const WayPath::Points> path;
+      };
+    mutable std::mutex                    pathCacheSync;
+    mutable std::list<CachedPath>         pathCache;
+    mutable std::unordered_map<uint64_t,std::list<CachedPath>::iterator> pathCacheIndex;
 
     void                   adjustWaypoints(std::vector<WayPoint> &wp);
 
     const FpIndex&         findFpIndex(const char* name) const;
     const WayPoint*        findFreePoint(float x, float y, float z, const FpIndex &ind, const WayPoint* ex) const;
+    size_t                 pointId(const WayPoint& p) const;
+    auto                   findPath(size_t startId, size_t endId) const -> std::shared_ptr<const WayPath::Points>;
+    auto                   findPathHierarchical(size_t startId, size_t endId) const -> std::shared_ptr<const WayPath::Points>;
+    bool                   search(PathScratch& s, size_t startId, size_t endId, uint32_t region) const;
+    void                   regionCosts(PathScratch& s, size_t from, std::vector<PortalEdge>& out) const;
+    void                   buildHierarchy();
+    void                   invalidatePathCache();
   };
@@ -6,36 +6,55 @@
 WayPath::WayPath() {
   }
 
+WayPath::WayPath(std::shared_ptr<const Points> d)
+  :dat(std::move(d)) {
+  if(dat!=nullptr)
+    size = dat->size();
+  }
+
 void WayPath::load(Serialize &fin) {
   uint32_t sz=0;
   fin.read(sz);
-  dat.resize(sz);
 
-  for(auto& i:dat)
+  auto pt = std::make_shared<Points>(sz);
+  for(auto& i:*pt)
     fin.read(i);
+  dat  = std::move(pt);
+  size = sz;
   }
 
 void WayPath::save(Serialize &fout) {
-  fout.write(uint32_t(dat.size()));
+  fout.write(uint32_t(size));
+
+  for(size_t i=0; i<size; ++i)
+    fout.write((*dat)[i]);
+  }
 
-  for(auto& i:dat)
-    fout.write(i);
+void WayPath::add(const WayPoint& p) {
+  // copy-on-write: never modify points, that can be shared
+  auto pt = std::make_shared<Points>();
+  pt->reserve(size+1);
+  if(dat!=nullptr)
+    pt->assign(dat->begin(),dat->begin()+int(size));
+  pt->push_back(&p);
+  dat = std::move(pt);
+  size++;
   }
 
 void WayPath::clear() {
-  dat.clear();
+  dat.reset();
+  size = 0;
   }
 
 const WayPoint *WayPath::pop() {
-  if(dat.size()==0)
+  if(size==0)
     return nullptr;
-  auto ret = dat[dat.size()-1];
-  dat.pop_back();
-  return ret;
+  size--;
+  return (*dat)[size];
   }
 
 const WayPoint *WayPath::last() const {
-  if(dat.size()==0)
+  if(size==0)
     return nullptr;
-  return dat[0];
+  return (*dat)[0];
   }
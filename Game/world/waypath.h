@@ -1,23 +1,29 @@
 #pragma once
 
 #include <vector>
+#include <memory>
 
 class WayPoint;
 class Serialize;
 
 class WayPath final {
   public:
+    using Points = std::vector<const WayPoint*>;
+
     WayPath();
+    WayPath(std::shared_ptr<const Points> dat);
 
     void load(Serialize& fin);
     void save(Serialize& fout);
 
-    void add(const WayPoint& p){ dat.push_back(&p); }
+    void add(const WayPoint& p);
     void clear();
 
     const WayPoint* pop();
     const WayPoint* last() const;
 
   private:
-    std::vector<const WayPoint*> dat;
+    // points are stored from end to start; may be shared with path cache
+    std::shared_ptr<const Points> dat;
+    size_t                        size=0;
   };
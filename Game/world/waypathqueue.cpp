@@ -0,0 +1,88 @@
+#include "waypathqueue.h"
+
+#include <atomic>
+#include <chrono>
+
+#include "game/movealgo.h"
+#include "utils/workers.h"
+#include "waymatrix.h"
+#include "npc.h"
+
+WayPathQueue::WayPathQueue(const WayMatrix& matrix)
+  :matrix(matrix) {
+  }
+
+bool WayPathQueue::poll(const Npc& npc, const WayPoint& end, WayPath& out) {
+  std::lock_guard<std::mutex> guard(sync);
+  for(size_t i=0; i<req.size(); ++i) {
+    auto& r = req[i];
+    if(r.npc!=&npc)
+      continue;
+    if(r.end!=&end || (r.pos-npc.position()).quadLength()>MaxDrift*MaxDrift) {
+      // destination changed or npc has moved away - restart request
+      r = Request();
+      break;
+      }
+    if(!r.ready)
+      return false;
+    out = std::move(r.path);
+    if(i+1<req.size())
+      r = std::move(req.back());
+    req.pop_back();
+    return true;
+    }
+
+  // new request: path will be ready on next tick
+  Request* r = nullptr;
+  for(auto& i:req)
+    if(i.npc==nullptr) {
+      r = &i;
+      break;
+      }
+  if(r==nullptr) {
+    req.emplace_back();
+    r = &req.back();
+    }
+
+  auto point = npc.currentWayPoint();
+  r->npc = &npc;
+  r->end = &end;
+  r->pos = npc.position();
+  if(point && !point->isFreePoint() && MoveAlgo::isClose(r->pos,*point))
+    r->start = point;
+  return false;
+  }
+
+void WayPathQueue::cancel(const Npc& npc) {
+  std::lock_guard<std::mutex> guard(sync);
+  for(size_t i=0; i<req.size(); ++i)
+    if(req[i].npc==&npc) {
+      if(i+1<req.size())
+        req[i] = std::move(req.back());
+      req.pop_back();
+      return;
+      }
+  }
+
+void WayPathQueue::tick() {
+  std::lock_guard<std::mutex> guard(sync);
+  batch.clear();
+  for(auto& r:req)
+    if(r.npc!=nullptr && !r.ready)
+      batch.push_back(&r);
+  if(batch.empty())
+    return;
+
+  // requests over budget remain in queue, NPC keeps idle until next frame
+  const auto       deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(FrameBudgetUs);
+  std::atomic<int> done{0};
+  Workers::parallelFor(batch,[this,&deadline,&done](Request* r){
+    if(done.load()>0 && std::chrono::steady_clock::now()>deadline)
+      return;
+    if(r->start!=nullptr)
+      r->path = matrix.wayTo(*r->start,*r->end); else
+      r->path = matrix.wayTo(r->pos.x,r->pos.y,r->pos.z,*r->end);
+    r->ready = true;
+    done.fetch_add(1);
+    });
+  }
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Tempest/Vec>
+
+#include <vector>
+#include <mutex>
+
+#include "waypath.h"
+
+class Npc;
+class WayPoint;
+class WayMatrix;
+
+class WayPathQueue final {
+  public:
+    WayPathQueue(const WayMatrix& matrix);
+
+    bool  poll  (const Npc& npc, const WayPoint& end, WayPath& out);
+    void  cancel(const Npc& npc);
+    void  tick();
+
+  private:
+    enum {
+      FrameBudgetUs = 2000,
+      MaxDrift      = 100,
+      };
+
+    struct Request final {
+      const Npc*      npc   = nullptr;
+      const WayPoint* start = nullptr;
+      Tempest::Vec3   pos;
+      const WayPoint* end   = nullptr;
+      bool            ready = false;
+      WayPath         path;
+      };
+
+    const WayMatrix&      matrix;
+    std::mutex            sync;
+    std::vector<Request>  req;
+    std::vector<Request*> batch;
+  };
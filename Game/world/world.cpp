@@ -40,6 +40,7 @@ World::World(Gothic& gothic, GameSession& game,const RendererStorage &storage, s
   loadProgress(70);
 
   wmatrix.reset(new WayMatrix(*this,world.waynet));
+  wpathQueue.reset(new WayPathQueue(*wmatrix));
   if(1){
     for(auto& vob:world.rootVobs)
       wobj.addRoot(std::move(vob),true);
@@ -73,6 +74,7 @@ World::World(Gothic& gothic, GameSession &game, const RendererStorage &storage,
   loadProgress(70);
 
   wmatrix.reset(new WayMatrix(*this,world.waynet));
+  wpathQueue.reset(new WayPathQueue(*wmatrix));
   if(1){
     for(auto& vob:world.rootVobs)
       wobj.addRoot(std::move(vob),false);
@@ -144,15 +146,11 @@ uint32_t World::itmId(const void *ptr) const {
   }
 
 Npc *World::npcById(uint32_t id) {
-  if(id<wobj.npcCount())
-    return &wobj.npc(id);
-  return nullptr;
+  return wobj.npcById(id);
   }
 
 Item *World::itmById(uint32_t id) {
-  if(id<wobj.itmCount())
-    return &wobj.itm(id);
-  return nullptr;
+  return wobj.itmById(id);
   }
 
 MeshObjects::Mesh World::getView(const char* visual) const {
@@ -295,7 +293,9 @@ void World::tick(uint64_t dt) {
   static bool doTicks=true;
   if(!doTicks)
     return;
+  wpathQueue->tick();
   wobj.tick(dt);
+  wobj.tickBullets(); // bullets spawned by physic callbacks wait until next tickBullets
   wdynamic->tick(dt);
   wview->tick(dt);
   if(auto pl = player())
@@ -306,6 +306,14 @@ uint64_t World::tickCount() const {
   return game.tickCount();
   }
 
+uint64_t World::renderTickCount() const {
+  return game.renderTickCount();
+  }
+
+float World::interpolation() const {
+  return game.interpolation();
+  }
+
 void World::setDayTime(int32_t h, int32_t min) {
   gtime now     = game.time();
   auto  day     = now.day();
@@ -334,9 +342,9 @@ size_t World::getSymbolIndex(const char *s) const {
 
 Focus World::validateFocus(const Focus &def) {
   Focus ret = def;
-  ret.npc         = wobj.validateNpc(ret.npc);
+  ret.npc         = wobj.validateNpc(ret.hNpc);
   ret.interactive = wobj.validateInteractive(ret.interactive);
-  ret.item        = wobj.validateItem(ret.item);
+  ret.item        = wobj.validateItem(ret.hItem);
 
   return ret;
   }
@@ -379,8 +387,8 @@ Focus World::findFocus(const Npc &pl, const Focus& def) {
   WorldObjects::SearchOpt optMob {policy.mob_range1,  policy.mob_range2,  policy.mob_azi,  coll };
   WorldObjects::SearchOpt optItm {policy.item_range1, policy.item_range2, policy.item_azi, coll };
 
-  auto n     = policy.npc_prio <0 ? nullptr : wobj.findNpc        (pl,def.npc,        optNpc);
-  auto it    = policy.item_prio<0 ? nullptr : wobj.findItem       (pl,def.item,       optItm);
+  auto n     = policy.npc_prio <0 ? nullptr : wobj.findNpc        (pl,def.hNpc,       optNpc);
+  auto it    = policy.item_prio<0 ? nullptr : wobj.findItem       (pl,def.hItem,      optItm);
   auto inter = policy.mob_prio <0 ? nullptr : wobj.findInteractive(pl,def.interactive,optMob);
   if(pl.weaponState()!=WeaponState::NoWeapon) {
     optMob.flags = WorldObjects::SearchFlg(WorldObjects::FcOverride | WorldObjects::NoRay);
@@ -827,17 +835,12 @@ void World::detectNpc(const float x, const float y, const float z, const float r
   wobj.detectNpc(x,y,z,r,f);
   }
 
-WayPath World::wayTo(const Npc &pos, const WayPoint &end) const {
-  auto p     = pos.position();
-  auto point = pos.currentWayPoint();
-  if(point && !point->isFreePoint() && MoveAlgo::isClose(pos.position(),*point)){
-    return wmatrix->wayTo(*point,end);
-    }
-  return wmatrix->wayTo(p.x,p.y,p.z,end);
+bool World::pollWayTo(const Npc& pos, const WayPoint& end, WayPath& out) {
+  return wpathQueue->poll(pos,end,out);
   }
 
-WayPath World::wayTo(float npcX, float npcY, float npcZ, const WayPoint &end) const {
-  return wmatrix->wayTo(npcX,npcY,npcZ,end);
+void World::cancelWayTo(const Npc& pos) {
+  wpathQueue->cancel(pos);
   }
 
 GameScript &World::script() const {
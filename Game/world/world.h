@@ -21,6 +21,7 @@
 #include "worldsound.h"
 #include "waypoint.h"
 #include "waymatrix.h"
+#include "waypathqueue.h"
 #include "resources.h"
 
 class GameSession;
@@ -72,8 +73,8 @@ class World final {
     void            detectNpc(const Tempest::Vec3& p, const float r, std::function<void(Npc&)> f);
     void            detectNpc(const float x, const float y, const float z, const float r, std::function<void(Npc&)> f);
 
-    WayPath         wayTo(const Npc& pos,const WayPoint& end) const;
-    WayPath         wayTo(float npcX,float npcY,float npcZ,const WayPoint& end) const;
+    bool            pollWayTo(const Npc& pos,const WayPoint& end,WayPath& out);
+    void            cancelWayTo(const Npc& pos);
 
     WorldView*      view()   const { return wview.get();    }
     DynamicWorld*   physic() const { return wdynamic.get(); }
@@ -110,6 +111,8 @@ class World final {
 
     void                 tick(uint64_t dt);
     uint64_t             tickCount() const;
+    uint64_t             renderTickCount() const;
+    float                interpolation() const;
     void                 setDayTime(int32_t h,int32_t min);
     gtime                time() const;
 
@@ -178,6 +181,7 @@ class World final {
     GameSession&                          game;
 
     std::unique_ptr<WayMatrix>            wmatrix;
+    std::unique_ptr<WayPathQueue>         wpathQueue;
     ZenLoad::zCBspTreeData                bsp;
     std::vector<BspSector>                bspSectors;
 
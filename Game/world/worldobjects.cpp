@@ -5,6 +5,7 @@
 #include "item.h"
 #include "npc.h"
 #include "world.h"
+#include "utils/framearena.h"
 #include "utils/workers.h"
 
 #include "world/triggers/codemaster.h"
@@ -12,15 +13,44 @@
 #include "world/triggers/triggerlist.h"
 #include "world/triggers/triggerworldstart.h"
 #include "world/triggers/messagefilter.h"
+#include "world/triggers/movetrigger.h"
 #include "world/vob.h"
 
 #include <Tempest/Painter>
 #include <Tempest/Application>
 #include <Tempest/Log>
 
+#include <chrono>
+#include <tuple>
+
 using namespace Tempest;
 using namespace Daedalus::GameState;
 
+static bool isInView(const Npc& npc, const WorldView* view) {
+  if(view==nullptr)
+    return true;
+  auto pos = npc.position();
+  pos.y = npc.centerY();
+  return view->isInView(pos,100.f);
+  }
+
+static uint64_t aiTickPeriod(const Npc& npc, const WorldView* view) {
+  switch(npc.processPolicy()) {
+    case Npc::ProcessPolicy::Player:
+    case Npc::ProcessPolicy::AiNormal:
+      return 0;
+    case Npc::ProcessPolicy::AiFar:
+      if(npc.weaponState()!=WeaponState::NoWeapon)
+        return 0;
+      return isInView(npc,view) ? 100 : 250;
+    case Npc::ProcessPolicy::AiFar2:
+      if(npc.isDead())
+        return 1000;
+      return isInView(npc,view) ? 100 : 250;
+    }
+  return 0;
+  }
+
 int32_t WorldObjects::MobStates::stateByTime(gtime t) const {
   t = t.timeInDay();
   for(size_t i=routines.size(); i>0; ) {
@@ -34,6 +64,17 @@ int32_t WorldObjects::MobStates::stateByTime(gtime t) const {
   return 0;
   }
 
+gtime WorldObjects::MobStates::nextTime(gtime t) const {
+  const gtime inDay = t.timeInDay();
+  for(auto& i:routines) {
+    if(inDay<i.time)
+      return gtime(t.day(),i.time.hour(),i.time.minute());
+    }
+  if(routines.size()>0)
+    return gtime(t.day()+1,routines[0].time.hour(),routines[0].time.minute());
+  return gtime::endOfTime();
+  }
+
 void WorldObjects::MobStates::save(Serialize& fout) {
   fout.write(curState,scheme);
   fout.write(uint32_t(routines.size()));
@@ -67,17 +108,30 @@ void WorldObjects::load(Serialize &fin) {
   uint32_t sz = uint32_t(npcArr.size());
 
   fin.read(sz);
+  for(auto& i:npcArr)
+    npcHandles.erase(*i);
   npcArr.clear();
-  for(size_t i=0;i<sz;++i)
+  // id in save-file is the file index; remember its handle, free slots may come in any order
+  npcLoadH.resize(sz);
+  for(size_t i=0;i<sz;++i) {
     npcArr.emplace_back(std::make_unique<Npc>(owner,size_t(-1),nullptr));
+    npcHandles.insert(*npcArr.back());
+    npcLoadH[i] = npcArr.back()->objHandle();
+    }
   for(auto& i:npcArr)
     i->load(fin);
+  std::stable_sort(npcArr.begin(),npcArr.end(),npcOrder);
 
   fin.read(sz);
+  for(auto& i:itemArr)
+    itmHandles.erase(*i);
   itemArr.clear();
+  itmLoadH.resize(sz);
   for(size_t i=0;i<sz;++i){
     auto it = std::make_unique<Item>(owner,fin,true);
     itemArr.emplace_back(std::move(it));
+    itmHandles.insert(*itemArr.back());
+    itmLoadH[i] = itemArr.back()->objHandle();
     items.add(itemArr.back().get());
     }
 
@@ -86,12 +140,22 @@ void WorldObjects::load(Serialize &fin) {
     throw std::logic_error("inconsistent *.sav vs world");
   for(auto& i:rootVobs)
     i->loadVobTree(fin);
+  // vob positions are restored from save: reindex static trigger volumes
+  triggersZnIndex.clear();
+  for(auto tg:triggers) {
+    if(!tg->hasVolume() || tg->isDynamic())
+      continue;
+    Vec3 bbox[2];
+    tg->volumeBounds(bbox[0],bbox[1]);
+    triggersZnIndex.add(bbox[0],bbox[1],tg);
+    }
   if(fin.version()>=10) {
     uint32_t sz = 0;
     fin.read(sz);
     triggerEvents.resize(sz);
     for(auto& i:triggerEvents)
       i.load(fin);
+    triggerTimers.clear();
     }
   if(fin.version()>=16) {
     uint32_t sz = 0;
@@ -100,9 +164,25 @@ void WorldObjects::load(Serialize &fin) {
     for(auto& i:routines)
       i.load(fin);
     }
+  routinesDirty = true;
+  }
+
+template<class T>
+static void mkSaveIndex(std::vector<uint32_t>& remap, const std::vector<std::unique_ptr<T>>& arr) {
+  remap.clear();
+  for(size_t i=0;i<arr.size();++i) {
+    uint32_t h = arr[i]->objHandle().id;
+    if(h>=remap.size())
+      remap.resize(h+1,uint32_t(-1));
+    remap[h] = uint32_t(i);
+    }
   }
 
 void WorldObjects::save(Serialize &fout) {
+  // objects are written in array order; remap handle index to file index for this save
+  mkSaveIndex(npcSaveId,npcArr);
+  mkSaveIndex(itmSaveId,itemArr);
+
   uint32_t sz = uint32_t(npcArr.size());
   fout.write(sz);
   for(auto& i:npcArr)
@@ -117,9 +197,12 @@ void WorldObjects::save(Serialize &fout) {
   fout.write(sz);
   for(auto& i:rootVobs)
     i->saveVobTree(fout);
-  fout.write(uint32_t(triggerEvents.size()));
+  fout.write(uint32_t(triggerEvents.size()+triggerTimers.size()));
   for(auto& i:triggerEvents)
     i.save(fout);
+  triggerTimers.forEach([&fout](const TriggerEvent& e){
+    e.save(fout);
+    });
 
   fout.write(uint32_t(routines.size()));
   for(auto& i:routines)
@@ -127,22 +210,15 @@ void WorldObjects::save(Serialize &fout) {
   }
 
 void WorldObjects::tick(uint64_t dt) {
-  auto passive=std::move(sndPerc);
+  // double buffer: perceptions sent during this tick go to next one, both keep their capacity
+  std::swap(sndPerc,sndPercTk);
   sndPerc.clear();
 
-  std::sort(npcArr.begin(),npcArr.end(),[](std::unique_ptr<Npc>& a, std::unique_ptr<Npc>& b){
-    return a->handle()->id<b->handle()->id;
-    });
-  for(size_t i=0; i<npcArr.size(); ++i)
-    npcArr[i]->tick(dt);
+  for(auto& i:npcArr)
+    i->storeSimPosition();
+  tickNpc(dt);
 
-  for(auto& i:routines) {
-    auto s = i.stateByTime(owner.time());
-    if(s!=i.curState) {
-      setMobState(i.scheme.c_str(),s);
-      i.curState = s;
-      }
-    }
+  tickRoutines();
 
   for(auto& i:interactiveObj)
     i->tick(dt);
@@ -150,10 +226,6 @@ void WorldObjects::tick(uint64_t dt) {
   for(auto i:triggersTk)
     i->tick(dt);
 
-  bullets.remove_if([](Bullet& b){
-    return b.flags()&Bullet::Stopped;
-    });
-
   auto pl = owner.player();
   if(pl==nullptr)
     return;
@@ -179,49 +251,86 @@ void WorldObjects::tick(uint64_t dt) {
   tickNear(dt);
   tickTriggers(dt);
 
+  tickPassivePerc(sndPercTk);
+
+  // sensing is read-only: run it at once for all due npc's, then let scripts react in order
+  npcPerc.clear();
+  for(auto& i:npcArr)
+    if(!i->isPlayer() && i->percNextTime()<=owner.tickCount())
+      npcPerc.push_back(i.get());
+  Workers::parallelFor(npcPerc,[pl](Npc* i){
+    i->perceptionSense(*pl);
+    });
+
   for(auto& ptr:npcArr) {
     Npc& i = *ptr;
     if(i.isPlayer())
       continue;
-
-    if(i.processPolicy()==Npc::AiNormal) {
-      for(auto& r:passive) {
-        if(r.self==&i)
-          continue;
-        float l = i.qDistTo(r.pos.x,r.pos.y,r.pos.z);
-        if(r.item!=size_t(-1) && r.other!=nullptr)
-          owner.script().setInstanceItem(*r.other,r.item);
-        const float range = float(i.handle()->senses_range);
-        if(l<range*range) {
-          // aproximation of behavior of original G2
-          if(!i.isDown() && !i.isPlayer() &&
-             i.canSenseNpc(*r.other, true)!=SensesBit::SENSE_NONE &&
-             i.canSenseNpc(*r.victum,true,float(r.other->handle()->senses_range))!=SensesBit::SENSE_NONE
-            ) {
-            i.perceptionProcess(*r.other,r.victum,l,Npc::PercType(r.what));
-            }
-          }
-        }
-      }
-
     if(i.percNextTime()>owner.tickCount())
       continue;
     i.perceptionProcess(*pl);
     }
   }
 
+void WorldObjects::tickBullets() {
+  for(size_t i=0; i<bullets.size();) {
+    if(bullets[i].flags()&Bullet::Stopped) {
+      if(i+1<bullets.size())
+        bullets[i] = std::move(bullets.back());
+      bullets.pop_back();
+      } else {
+      ++i;
+      }
+    }
+  for(auto& i:bulletsNew)
+    bullets.emplace_back(std::move(i));
+  bulletsNew.clear();
+  }
+
 uint32_t WorldObjects::npcId(const Npc *ptr) const {
   if(ptr==nullptr)
     return uint32_t(-1);
+  auto h = ptr->objHandle();
+  if(npcHandles.get(h)!=ptr)
+    return uint32_t(-1);
+  if(h.id<npcSaveId.size()) {
+    uint32_t id = npcSaveId[h.id];
+    if(id<npcArr.size() && npcArr[id].get()==ptr)
+      return id;
+    }
   for(size_t i=0;i<npcArr.size();++i)
     if(npcArr[i].get()==ptr)
       return uint32_t(i);
   return uint32_t(-1);
   }
 
+Npc* WorldObjects::npcById(uint32_t id) const {
+  if(id>=npcLoadH.size())
+    return nullptr;
+  return npcHandles.get(npcLoadH[id]);
+  }
+
+Item* WorldObjects::itmById(uint32_t id) const {
+  if(id>=itmLoadH.size())
+    return nullptr;
+  return itmHandles.get(itmLoadH[id]);
+  }
+
 uint32_t WorldObjects::itmId(const void *ptr) const {
+  auto hitem = reinterpret_cast<const Daedalus::GEngineClasses::C_Item*>(ptr);
+  if(hitem==nullptr || hitem->userPtr==nullptr)
+    return uint32_t(-1);
+  auto itm = reinterpret_cast<const Item*>(hitem->userPtr);
+  auto h   = itm->objHandle();
+  if(itmHandles.get(h)!=itm)
+    return uint32_t(-1);
+  if(h.id<itmSaveId.size()) {
+    uint32_t id = itmSaveId[h.id];
+    if(id<itemArr.size() && itemArr[id].get()==itm)
+      return id;
+    }
   for(size_t i=0;i<itemArr.size();++i)
-    if(itemArr[i]->handle()==ptr)
+    if(itemArr[i].get()==itm)
       return uint32_t(i);
   return uint32_t(-1);
   }
@@ -245,8 +354,7 @@ Npc *WorldObjects::addNpc(size_t npcInstance, const Daedalus::ZString& at) {
     npc->updateTransform();
     }
 
-  npcArr.emplace_back(npc);
-  return npc;
+  return insertNpc(std::unique_ptr<Npc>(npc));
   }
 
 Npc* WorldObjects::addNpc(size_t npcInstance, const Vec3& pos) {
@@ -255,8 +363,7 @@ Npc* WorldObjects::addNpc(size_t npcInstance, const Vec3& pos) {
   //npc->setDirection (pos->dirX,pos->dirY,pos->dirZ);
   npc->updateTransform();
 
-  npcArr.emplace_back(npc);
-  return npc;
+  return insertNpc(std::unique_ptr<Npc>(npc));
   }
 
 Npc* WorldObjects::insertPlayer(std::unique_ptr<Npc> &&npc, const Daedalus::ZString& at) {
@@ -277,8 +384,7 @@ Npc* WorldObjects::insertPlayer(std::unique_ptr<Npc> &&npc, const Daedalus::ZStr
     npc->attachToPoint(pos);
     npc->updateTransform();
     }
-  npcArr.emplace_back(std::move(npc));
-  return npcArr.back().get();
+  return insertNpc(std::move(npc));
   }
 
 std::unique_ptr<Npc> WorldObjects::takeNpc(const Npc* ptr) {
@@ -286,24 +392,203 @@ std::unique_ptr<Npc> WorldObjects::takeNpc(const Npc* ptr) {
     auto& npc=*npcArr[i];
     if(&npc==ptr){
       auto ret=std::move(npcArr[i]);
-      npcArr[i] = std::move(npcArr.back());
-      npcArr.pop_back();
+      npcArr.erase(npcArr.begin()+int(i));
+      npcHandles.erase(*ret);
       return ret;
       }
     }
   return nullptr;
   }
 
+void WorldObjects::tickRoutines() {
+  auto        order = [](const MobEvent& l, const MobEvent& r){ return r.time<l.time; };
+  const gtime now   = owner.time();
+  if(routinesDirty || now<routinesTime) {
+    // schedule changed or clock went back: reevaluate everything
+    routinesQueue.clear();
+    for(size_t i=0; i<routines.size(); ++i) {
+      MobEvent e;
+      e.time = now;
+      e.id   = i;
+      routinesQueue.push_back(e);
+      }
+    routinesDirty = false;
+    }
+  routinesTime = now;
+
+  while(routinesQueue.size()>0 && routinesQueue[0].time<=now) {
+    std::pop_heap(routinesQueue.begin(),routinesQueue.end(),order);
+    MobEvent e = routinesQueue.back();
+    routinesQueue.pop_back();
+
+    auto s = routines[e.id].stateByTime(now);
+    if(s!=routines[e.id].curState) {
+      routines[e.id].curState = s;
+      setMobState(routines[e.id].scheme.c_str(),s);
+      }
+
+    e.time = routines[e.id].nextTime(now);
+    if(e.time==gtime::endOfTime())
+      continue;
+    routinesQueue.push_back(e);
+    std::push_heap(routinesQueue.begin(),routinesQueue.end(),order);
+    }
+  }
+
+void WorldObjects::tickNpc(uint64_t dt) {
+  // near npc's are updated every frame, far ones with lower rate and round-robin, until budget is over
+  const WorldView* view = owner.view();
+  npcTick.clear();
+  for(auto& i:npcArr)
+    if(aiTickPeriod(*i,view)==0)
+      npcTick.push_back(i.get());
+  const size_t nearCount = npcTick.size();
+
+  for(size_t i=0; i<npcArr.size(); ++i) {
+    Npc&           npc    = *npcArr[(aiCursor+i)%npcArr.size()];
+    const uint64_t period = aiTickPeriod(npc,view);
+    if(period==0)
+      continue;
+    if(npc.skippedTime()+dt<period)
+      npc.skipTick(dt); else
+      npcTick.push_back(&npc);
+    }
+
+  Workers::parallelFor(npcTick,[](Npc* i){
+    i->tickAnimation();
+    });
+
+  // NOTE: pointers are stable - npc's spawned by scripts in this loop are updated next frame
+  for(size_t i=0; i<nearCount; ++i)
+    npcTick[i]->tick(dt);
+
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(FarBudgetUs);
+  for(size_t i=nearCount; i<npcTick.size(); ++i) {
+    if(i>nearCount && std::chrono::steady_clock::now()>deadline) {
+      // out of budget - start from first skipped npc next frame
+      Npc* next = npcTick[i];
+      for(size_t r=0; r<npcArr.size(); ++r)
+        if(npcArr[r].get()==next)
+          aiCursor = r;
+      for(; i<npcTick.size(); ++i)
+        npcTick[i]->skipTick(dt);
+      break;
+      }
+    npcTick[i]->tick(dt);
+    }
+  }
+
+void WorldObjects::tickPassivePerc(const std::vector<PerceptionMsg>& passive) {
+  if(passive.size()==0)
+    return;
+
+  struct Los final {
+    Npc* self    = nullptr;
+    Npc* other   = nullptr;
+    bool visible = false;
+    bool operator <  (const Los& l) const { return std::tie(self,other)< std::tie(l.self,l.other); }
+    bool operator == (const Los& l) const { return std::tie(self,other)==std::tie(l.self,l.other); }
+    };
+
+  struct Check final {
+    Npc*                 self = nullptr;
+    const PerceptionMsg* msg  = nullptr;
+    float                dist = 0;
+    SensesBit            sense  [2] = {};
+    bool                 needLos[2] = {};
+    };
+
+  // only near npc's(AiNormal) are receivers; gather all sense checks without raycasts first
+  FrameVector<Check> check;
+  FrameVector<Los>   los;
+  for(Npc* i:npcNear) {
+    if(i->isPlayer() || i->isDown() || i->processPolicy()!=Npc::AiNormal)
+      continue;
+    const float range = float(i->handle()->senses_range);
+    for(auto& r:passive) {
+      if(r.self==i)
+        continue;
+      const float l = i->qDistTo(r.pos.x,r.pos.y,r.pos.z);
+      if(l>=range*range)
+        continue;
+      // aproximation of behavior of original G2
+      Check c;
+      c.self  = i;
+      c.msg   = &r;
+      c.dist  = l;
+      c.sense[0] = i->canSenseNpcNoLos(*r.other, 0,                                  c.needLos[0]);
+      c.sense[1] = i->canSenseNpcNoLos(*r.victum,float(r.other->handle()->senses_range),c.needLos[1]);
+      if((c.sense[0]==SensesBit::SENSE_NONE && !c.needLos[0]) ||
+         (c.sense[1]==SensesBit::SENSE_NONE && !c.needLos[1]))
+        continue;
+      if(c.needLos[0])
+        los.push_back({i,r.other});
+      if(c.needLos[1])
+        los.push_back({i,r.victum});
+      check.push_back(c);
+      }
+    }
+
+  // same pair is tested once per frame; rays are casted as one parallel batch
+  std::sort(los.begin(),los.end());
+  los.erase(std::unique(los.begin(),los.end()),los.end());
+
+  FrameVector<DynamicWorld::RayQuery>  rq (los.size());
+  FrameVector<DynamicWorld::RayResult> hit(los.size());
+  for(size_t i=0; i<los.size(); ++i) {
+    rq[i].from = los[i].self ->position() + Vec3(0,180,0);
+    rq[i].to   = los[i].other->position() + Vec3(0,180,0);
+    }
+  owner.physic()->ray(rq.data(),hit.data(),rq.size());
+  for(size_t i=0; i<los.size(); ++i)
+    los[i].visible = !hit[i].hasCol;
+
+  auto canSense = [&los](Npc* self, Npc* other, SensesBit s, bool needLos) {
+    if(s!=SensesBit::SENSE_NONE)
+      return true;
+    if(!needLos)
+      return false;
+    Los key = {self,other};
+    auto it = std::lower_bound(los.begin(),los.end(),key);
+    return it!=los.end() && it->visible;
+    };
+
+  for(auto& c:check) {
+    auto& r = *c.msg;
+    if(c.self->isDown())
+      continue;
+    if(!canSense(c.self,r.other, c.sense[0],c.needLos[0]) ||
+       !canSense(c.self,r.victum,c.sense[1],c.needLos[1]))
+      continue;
+    if(r.item!=size_t(-1) && r.other!=nullptr)
+      owner.script().setInstanceItem(*r.other,r.item);
+    c.self->perceptionProcess(*r.other,r.victum,c.dist,Npc::PercType(r.what));
+    }
+  }
+
 void WorldObjects::tickNear(uint64_t /*dt*/) {
   for(Npc* i:npcNear) {
     auto pos=i->position();
-    for(AbstractTrigger* t:triggersZn)
-      if(t->checkPos(pos.x,pos.y+i->translateY(),pos.z))
+    pos.y += i->translateY();
+
+    triggersHit.clear();
+    triggersZnIndex.find(pos,[this](AbstractTrigger& t){
+      triggersHit.push_back(&t);
+      });
+    for(AbstractTrigger* t:triggersZnMovable)
+      triggersHit.push_back(t);
+
+    for(AbstractTrigger* t:triggersHit)
+      if(t->checkPos(pos.x,pos.y,pos.z))
         t->onIntersect(*i);
     }
   }
 
 void WorldObjects::tickTriggers(uint64_t /*dt*/) {
+  triggerTimers.advance(owner.tickCount(),[this](TriggerEvent& e){
+    execTriggerEvent(e);
+    });
+
   auto evt = std::move(triggerEvents);
   triggerEvents.clear();
 
@@ -318,23 +603,28 @@ void WorldObjects::triggerEvent(const TriggerEvent &e) {
 
 void WorldObjects::execTriggerEvent(const TriggerEvent& e) {
   if(e.timeBarrier>owner.tickCount()) {
-    triggerEvent(std::move(e));
+    triggerTimers.insert(e.timeBarrier,TriggerEvent(e));
     return;
     }
 
-  bool emitted=false;
-  for(auto& i:triggers) {
-    auto& t = *i;
-    if(t.name()==e.target) { // NOTE: trigger name is not unique - more then one trigger can be activated
-      t.processEvent(e);
-      emitted=true;
-      }
-    }
-  if(!emitted)
+  auto it = triggersByName.find(e.target);
+  if(it==triggersByName.end()) {
     Log::d("unable to process trigger: \"",e.target,"\"");
+    return;
+    }
+  // NOTE: trigger name is not unique - more then one trigger can be activated
+  for(auto i:it->second)
+    i->processEvent(e);
   }
 
 void WorldObjects::updateAnimation() {
+  // movers first: mobs attached to them take the interpolated position
+  for(auto i:triggersMv)
+    i->updateAnimation();
+  for(auto& i:bullets)
+    i.updateAnimation();
+  for(auto& i:bulletsNew)
+    i.updateAnimation();
   Workers::parallelFor(npcArr,[](std::unique_ptr<Npc>& i){
     i->updateAnimation();
     });
@@ -393,9 +683,20 @@ void WorldObjects::detectNpc(const float x, const float y, const float z,
   }
 
 void WorldObjects::addTrigger(AbstractTrigger* tg) {
-  if(tg->hasVolume())
-    triggersZn.emplace_back(tg);
+  if(tg->hasVolume()) {
+    if(tg->isDynamic()) {
+      // volume is moving along with mover - can't be indexed
+      triggersZnMovable.emplace_back(tg);
+      } else {
+      Vec3 bbox[2];
+      tg->volumeBounds(bbox[0],bbox[1]);
+      triggersZnIndex.add(bbox[0],bbox[1],tg);
+      }
+    }
+  if(tg->vobType()==ZenLoad::zCVobData::VT_zCMover)
+    triggersMv.emplace_back(static_cast<MoveTrigger*>(tg));
   triggers.emplace_back(tg);
+  triggersByName[tg->name()].push_back(tg);
   }
 
 void WorldObjects::triggerOnStart(bool firstTime) {
@@ -438,6 +739,7 @@ Item *WorldObjects::takeItem(Item &it) {
       i = std::move(itemArr.back());
       itemArr.pop_back();
       items.del(ret);
+      itmHandles.erase(*ret);
       return ret;
       }
   return nullptr;
@@ -461,8 +763,9 @@ Bullet& WorldObjects::shootBullet(const Item& itmId,
                                   float x, float y, float z,
                                   float dx, float dy, float dz,
                                   float speed) {
-  bullets.emplace_back(owner,itmId,x,y,z);
-  auto& b = bullets.back();
+  // physics callbacks hold Bullet's from 'bullets' on stack: new ones are merged by tickBullets
+  bulletsNew.emplace_back(owner,itmId,x,y,z);
+  auto& b = bulletsNew.back();
 
   const float l = std::sqrt(dx*dx+dy*dy+dz*dz);
 
@@ -479,6 +782,7 @@ Item *WorldObjects::addItem(size_t itemInstance, const char *at) {
   std::unique_ptr<Item> ptr{new Item(owner,itemInstance)};
   auto* it=ptr.get();
   itemArr.emplace_back(std::move(ptr));
+  itmHandles.insert(*it);
   items.add(itemArr.back().get());
 
   if(pos!=nullptr) {
@@ -514,17 +818,6 @@ Interactive* WorldObjects::validateInteractive(Interactive *def) {
   return interactiveObj.hasObject(def) ? def : nullptr;
   }
 
-Npc *WorldObjects::validateNpc(Npc *def) {
-  for(auto& i:npcArr)
-    if(i.get()==def)
-      return def;
-  return nullptr;
-  }
-
-Item *WorldObjects::validateItem(Item *def) {
-  return items.hasObject(def) ? def : nullptr;
-  }
-
 Interactive* WorldObjects::findInteractive(const Npc &pl, Interactive* def, const SearchOpt& opt) {
   def = validateInteractive(def);
   if(def && testObj(*def,pl,opt))
@@ -545,8 +838,8 @@ Interactive* WorldObjects::findInteractive(const Npc &pl, Interactive* def, cons
   return ret;
   }
 
-Npc* WorldObjects::findNpc(const Npc &pl, Npc *def, const SearchOpt& opt) {
-  def = validateNpc(def);
+Npc* WorldObjects::findNpc(const Npc &pl, ObjHandle hdef, const SearchOpt& opt) {
+  auto def = validateNpc(hdef);
   if(def) {
     auto xopt  = opt;
     xopt.flags = SearchFlg(xopt.flags | SearchFlg::NoAngle | SearchFlg::NoRay);
@@ -557,8 +850,8 @@ Npc* WorldObjects::findNpc(const Npc &pl, Npc *def, const SearchOpt& opt) {
   return r ? r->get() : nullptr;
   }
 
-Item *WorldObjects::findItem(const Npc &pl, Item *def, const SearchOpt& opt) {
-  def = validateItem(def);
+Item *WorldObjects::findItem(const Npc &pl, ObjHandle hdef, const SearchOpt& opt) {
+  auto def = validateItem(hdef);
   if(def && testObj(*def,pl,opt))
     return def;
   if(owner.view()==nullptr)
@@ -636,6 +929,7 @@ void WorldObjects::setMobRoutine(gtime time, const Daedalus::ZString& scheme, in
       std::sort(i.routines.begin(),i.routines.end(),[](const MobRoutine& l, const MobRoutine& r){
         return l.time<r.time;
         });
+      routinesDirty = true;
       return;
       }
     }
@@ -643,6 +937,7 @@ void WorldObjects::setMobRoutine(gtime time, const Daedalus::ZString& scheme, in
   st.scheme = scheme;
   st.routines.push_back(r);
   routines.emplace_back(std::move(st));
+  routinesDirty = true;
   }
 
 void WorldObjects::sendPassivePerc(Npc &self, Npc &other, Npc &victum, int32_t perc) {
@@ -678,6 +973,7 @@ void WorldObjects::resetPositionToTA() {
     if(n.resetPositionToTA()){
       ++i;
       } else {
+      npcHandles.erase(n);
       npcInvalid.emplace_back(std::move(npcArr[i]));
       npcArr.erase(npcArr.begin()+int(i));
 
@@ -689,6 +985,18 @@ void WorldObjects::resetPositionToTA() {
     }
   }
 
+Npc* WorldObjects::insertNpc(std::unique_ptr<Npc>&& npc) {
+  // npcArr is kept ordered by id, for deterministic update order
+  auto at = std::upper_bound(npcArr.begin(),npcArr.end(),npc,npcOrder);
+  npcHandles.insert(*npc);
+  at = npcArr.insert(at,std::move(npc));
+  return at->get();
+  }
+
+bool WorldObjects::npcOrder(const std::unique_ptr<Npc>& a, const std::unique_ptr<Npc>& b) {
+  return a->handle()->id<b->handle()->id;
+  }
+
 void WorldObjects::setMobState(const char* scheme, int32_t st) {
   for(auto& i:rootVobs)
     i->setMobState(scheme,st);
@@ -2,23 +2,27 @@
 
 #include <vector>
 #include <memory>
+#include <unordered_map>
 
 #include <daedalus/DaedalusGameState.h>
 
 #include "bullet.h"
+#include "bboxtree.h"
+#include "handletable.h"
 #include "interactive.h"
 #include "spaceindex.h"
 #include "staticobj.h"
+#include "timerwheel.h"
 #include "game/gametime.h"
 #include "game/perceptionmsg.h"
+#include "triggers/abstracttrigger.h"
 
 class Npc;
 class Item;
 class Vob;
 class World;
 class Serialize;
-class TriggerEvent;
-class AbstractTrigger;
+class MoveTrigger;
 
 class WorldObjects final {
   public:
@@ -46,9 +50,12 @@ class WorldObjects final {
     void           load(Serialize& fout);
     void           save(Serialize& fout);
     void           tick(uint64_t dt);
+    void           tickBullets();
 
     uint32_t       npcId(const Npc *ptr) const;
     uint32_t       itmId(const void* ptr) const;
+    Npc*           npcById(uint32_t id) const;
+    Item*          itmById(uint32_t id) const;
 
     Npc*           addNpc(size_t itemInstance, const Daedalus::ZString& at);
     Npc*           addNpc(size_t itemInstance, const Tempest::Vec3&     at);
@@ -90,12 +97,12 @@ class WorldObjects final {
     void           invalidateVobIndex();
 
     Interactive*   validateInteractive(Interactive *def);
-    Npc*           validateNpc        (Npc         *def);
-    Item*          validateItem       (Item        *def);
+    Npc*           validateNpc        (ObjHandle    def) const { return npcHandles.get(def); }
+    Item*          validateItem       (ObjHandle    def) const { return itmHandles.get(def); }
 
     Interactive*   findInteractive(const Npc& pl, Interactive *def, const SearchOpt& opt);
-    Npc*           findNpc        (const Npc& pl, Npc* def, const SearchOpt& opt);
-    Item*          findItem       (const Npc& pl, Item* def, const SearchOpt& opt);
+    Npc*           findNpc        (const Npc& pl, ObjHandle def, const SearchOpt& opt);
+    Item*          findItem       (const Npc& pl, ObjHandle def, const SearchOpt& opt);
 
     void           marchInteractives(Tempest::Painter &p, const Tempest::Matrix4x4 &mvp, int w, int h) const;
 
@@ -107,6 +114,10 @@ class WorldObjects final {
     void           resetPositionToTA();
 
   private:
+    enum {
+      FarBudgetUs = 4000,
+      };
+
     struct MobRoutine {
       gtime   time;
       int32_t state = 0;
@@ -117,10 +128,16 @@ class WorldObjects final {
       std::vector<MobRoutine> routines;
       int32_t                 curState = 0;
       int32_t                 stateByTime(gtime t) const;
+      gtime                   nextTime(gtime t) const;
       void                    save(Serialize& fout);
       void                    load(Serialize& fin);
       };
 
+    struct MobEvent {
+      gtime                   time;
+      size_t                  id = 0;
+      };
+
     World&                             owner;
     std::vector<std::unique_ptr<Vob>>  rootVobs;
 
@@ -129,20 +146,39 @@ class WorldObjects final {
 
     std::vector<StaticObj*>            objStatic;
     std::vector<std::unique_ptr<Item>> itemArr;
-    std::list<MobStates>               routines;
+    HandleTable<Item>                  itmHandles;
+    std::vector<uint32_t>              itmSaveId; // handle index -> save-file index
+    std::vector<ObjHandle>             itmLoadH;  // save-file index -> handle
+    std::vector<MobStates>             routines;
+    std::vector<MobEvent>              routinesQueue; // min-heap by time of next state change
+    gtime                              routinesTime;
+    bool                               routinesDirty = false;
 
-    std::list<Bullet>                  bullets;
+    std::vector<Bullet>                bullets;
+    std::vector<Bullet>                bulletsNew; // spawned since last tick
 
     std::vector<std::unique_ptr<Npc>>  npcArr;
     std::vector<std::unique_ptr<Npc>>  npcInvalid;
+    HandleTable<Npc>                   npcHandles;
+    std::vector<uint32_t>              npcSaveId;
+    std::vector<ObjHandle>             npcLoadH;
     std::vector<Npc*>                  npcNear;
+    std::vector<Npc*>                  npcTick;
+    std::vector<Npc*>                  npcPerc;
+    size_t                             aiCursor=0;
 
     std::vector<AbstractTrigger*>      triggers;
-    std::vector<AbstractTrigger*>      triggersZn;
+    BBoxTree<AbstractTrigger>          triggersZnIndex;
+    std::vector<AbstractTrigger*>      triggersZnMovable;
+    std::vector<AbstractTrigger*>      triggersHit;
     std::vector<AbstractTrigger*>      triggersTk;
+    std::vector<MoveTrigger*>          triggersMv;
+    std::unordered_map<std::string,std::vector<AbstractTrigger*>> triggersByName;
 
     std::vector<PerceptionMsg>         sndPerc;
+    std::vector<PerceptionMsg>         sndPercTk;
     std::vector<TriggerEvent>          triggerEvents;
+    TimerWheel<TriggerEvent>           triggerTimers;
 
     template<class T>
     auto findObj(T &src, const Npc &pl, const SearchOpt& opt) -> typename std::remove_reference<decltype(src[0])>::type*;
@@ -153,8 +189,13 @@ class WorldObjects final {
     bool testObj(T &src, const Npc &pl, const SearchOpt& opt, float& rlen);
 
     void             setMobState(const char* scheme, int32_t st);
+    Npc*             insertNpc(std::unique_ptr<Npc>&& npc);
+    static bool      npcOrder(const std::unique_ptr<Npc>& a, const std::unique_ptr<Npc>& b);
 
+    void             tickNpc(uint64_t dt);
+    void             tickRoutines();
     void             tickNear(uint64_t dt);
+    void             tickPassivePerc(const std::vector<PerceptionMsg>& passive);
     void             tickTriggers(uint64_t dt);
     static bool      isTargetedBy(Npc& npc,Npc& by);
   };
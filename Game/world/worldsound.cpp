@@ -12,6 +12,7 @@ using namespace Tempest;
 
 const float WorldSound::maxDist   = 3500; // 35 meters
 const float WorldSound::talkRange = 800;
+const float WorldSound::activeMargin = 1000; // listener movement, before active sounds are updated
 
 bool WorldSound::Zone::checkPos(float x, float y, float z) const {
   return
@@ -56,6 +57,9 @@ void WorldSound::addSound(const ZenLoad::zCVobData &vob) {
   s.eff.setRefDistance(0);
   s.eff.setVolume(0.5f);
 
+  s.pos      = Vec3(vob.position.x,vob.position.y,vob.position.z);
+  s.radius   = pr.sndRadius;
+
   s.loop     = pr.sndType==ZenLoad::SoundMode::SM_LOOPING;
   s.active   = pr.sndStartOn;
   s.delay    = uint64_t(pr.sndRandDelay*1000);
@@ -211,7 +215,13 @@ void WorldSound::tick(Npc &player) {
     tickSlot(i.second);
     }
 
-  for(auto& i:worldEff) {
+  if(worldEffIndex.size()!=worldEff.size() ||
+     (plPos-worldEffActivePos).quadLength()>activeMargin*activeMargin) {
+    updateActiveSounds();
+    }
+
+  for(auto pi:worldEffActive) {
+    auto& i = *pi;
     if(i.active && i.eff.isFinished() && (i.restartTimeout<owner.tickCount() || i.loop)){
       if(i.restartTimeout!=0) {
         auto time = owner.time();
@@ -237,16 +247,23 @@ void WorldSound::tickSoundZone(Npc& player) {
     return;
   nextSoundUpdate = owner.tickCount()+5*1000;
 
+  if(zonesIndex.size()!=zones.size()) {
+    zonesIndex.clear();
+    for(auto& z:zones)
+      zonesIndex.add(Vec3(z.bbox[0].x,z.bbox[0].y,z.bbox[0].z),Vec3(z.bbox[1].x,z.bbox[1].y,z.bbox[1].z),&z);
+    }
+
+  const Vec3 pos = Vec3(plPos.x,plPos.y+player.translateY(),plPos.z);
   Zone* zone=&def;
   if(currentZone!=nullptr &&
-     currentZone->checkPos(plPos.x,plPos.y+player.translateY(),plPos.z)){
+     currentZone->checkPos(pos.x,pos.y,pos.z)){
     zone = currentZone;
     } else {
-    for(auto& z:zones) {
-      if(z.checkPos(plPos.x,plPos.y+player.translateY(),plPos.z)) {
+    zonesIndex.find(pos,[&zone,&pos](Zone& z){
+      // last zone in declaration order takes priority
+      if(z.checkPos(pos.x,pos.y,pos.z) && (zone==&def || zone<&z))
         zone = &z;
-        }
-      }
+      });
     }
 
   gtime           time  = owner.time().timeInDay();
@@ -306,11 +323,28 @@ bool WorldSound::setMusic(const char* zone, GameMusic::Tags tags) {
   return false;
   }
 
+void WorldSound::updateActiveSounds() {
+  if(worldEffIndex.size()!=worldEff.size()) {
+    worldEffIndex.clear();
+    for(auto& i:worldEff) {
+      const float r = i.radius+activeMargin;
+      worldEffIndex.add(i.pos-Vec3(r,r,r),i.pos+Vec3(r,r,r),&i);
+      }
+    }
+  worldEffActivePos = plPos;
+  worldEffActive.clear();
+  worldEffIndex.find(plPos,[this](WSound& s){
+    worldEffActive.push_back(&s);
+    });
+  }
+
 void WorldSound::tickSlot(GSoundEffect& slot) {
   if(slot.isFinished())
     return;
   auto  dyn = owner.physic();
   auto  pos = slot.position();
+  if(!isInListenerRange(pos,0))
+    return; // too far to be heard - skip occlusion ray
   float occ = dyn->soundOclusion(plPos.x,plPos.y+180/*head pos*/,plPos.z, pos.x,pos.y,pos.z);
 
   slot.setOcclusion(std::max(0.f,1.f-occ));
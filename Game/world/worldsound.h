@@ -11,6 +11,7 @@
 
 #include "game/gametime.h"
 #include "gamemusic.h"
+#include "bboxtree.h"
 
 class GameSession;
 class World;
@@ -49,6 +50,8 @@ class WorldSound final {
       WSound(SoundFx&& s):proto(std::move(s)){}
       SoundFx      proto;
       GSoundEffect eff;
+      Tempest::Vec3 pos;
+      float        radius        =0;
 
       bool         loop          =false;
       bool         active        =false;
@@ -63,12 +66,14 @@ class WorldSound final {
       };
 
     void tickSoundZone(Npc& player);
+    void updateActiveSounds();
     bool setMusic(const char* zone, GameMusic::Tags tags);
 
     Gothic&                                 gothic;
     GameSession&                            game;
     World&                                  owner;
     std::vector<Zone>                       zones;
+    BBoxTree<Zone>                          zonesIndex;
     Zone                                    def;
 
     uint64_t                                nextSoundUpdate=0;
@@ -81,8 +86,12 @@ class WorldSound final {
     std::vector<GSoundEffect>               effect;
     std::vector<GSoundEffect>               effect3d; // snd_play3d
     std::vector<WSound>                     worldEff;
+    BBoxTree<WSound>                        worldEffIndex;
+    std::vector<WSound*>                    worldEffActive;
+    Tempest::Vec3                           worldEffActivePos;
 
     std::mutex                              sync;
 
     static const float maxDist;
+    static const float activeMargin;
   };